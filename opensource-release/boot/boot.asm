@@ -186,7 +186,7 @@ dap_lba:
 
 
 boot_drive:     db 0x80
-sectors_left:   dw 200
+sectors_left:   dw 256
 
 
 gdt_start:
@@ -299,6 +299,70 @@ bool FAT12::read_file(const char* filename, uint8_t* buffer, uint32_t max_size,
     return true;
 }
 
+bool FAT12::open_file(const char* filename, FAT12Cursor* cursor) {
+    if (!mounted) {
+        return false;
+    }
+
+    // read_cursor loads a whole cluster at a time into the cursor buffer.
+    if (boot_sector.sectors_per_cluster == 0 ||
+        boot_sector.sectors_per_cluster * 512u > sizeof(cursor->buffer)) {
+        return false;
+    }
+
+    FAT12DirectoryEntry* entry = find_file(filename);
+    if (!entry) {
+        return false;
+    }
+
+    cursor->cluster = entry->first_cluster;
+    cursor->file_size = entry->file_size;
+    cursor->position = 0;
+    cursor->buffered = 0;
+    cursor->offset = 0;
+    return true;
+}
+
+
+uint32_t FAT12::read_cursor(FAT12Cursor* cursor, uint8_t* buffer, uint32_t count) {
+    uint32_t bytes_per_cluster = boot_sector.sectors_per_cluster * 512;
+    uint32_t total = 0;
+
+    while (count > 0 && cursor->position < cursor->file_size) {
+        
+        if (cursor->offset == cursor->buffered) {
+            if (cursor->cluster < 2 || cursor->cluster == 0xFFFF) {
+                break;
+            }
+            if (!read_cluster(cursor->cluster, cursor->buffer)) {
+                break;
+            }
+            cursor->buffered = bytes_per_cluster;
+            if (cursor->buffered > cursor->file_size - cursor->position) {
+                cursor->buffered = cursor->file_size - cursor->position;
+            }
+            cursor->offset = 0;
+            cursor->cluster = get_next_cluster(cursor->cluster);
+        }
+
+        uint32_t chunk = cursor->buffered - cursor->offset;
+        if (chunk > count) {
+            chunk = count;
+        }
+
+        
+        if (buffer) {
+            memcpy(buffer + total, cursor->buffer + cursor->offset, chunk);
+        }
+        cursor->offset += chunk;
+        cursor->position += chunk;
+        total += chunk;
+        count -= chunk;
+    }
+
+    return total;
+}
+
 bool FAT12::list_directory() {
     if (!mounted) {
         return false;
@@ -0,0 +1,133 @@
+#include "animation_player.h"
+#include "string.h"
+
+
+const PackedAnimation* AnimationPlayer::animation = nullptr;
+Surface AnimationPlayer::frame;
+int AnimationPlayer::origin_x = 0;
+int AnimationPlayer::origin_y = 0;
+uint32_t AnimationPlayer::offset = 0;
+uint8_t AnimationPlayer::frame_index = 0;
+uint8_t AnimationPlayer::fps = ANIMATION_FPS_DEFAULT;
+uint32_t AnimationPlayer::next_frame_ms = 0;
+bool AnimationPlayer::scheduled = false;
+bool AnimationPlayer::paused = false;
+
+static uint8_t* frame_pixels[ANIMATION_COUNT];
+
+bool AnimationPlayer::start(AnimationId id, int x, int y, uint8_t rate) {
+    if (id >= ANIMATION_COUNT || !packed_animations[id].deltas) {
+        return false;
+    }
+
+    const PackedAnimation* packed = &packed_animations[id];
+    Surface keyframe;
+    if (!AssetCache::get(packed->keyframe, &keyframe)) {
+        return false;
+    }
+
+    
+    int size = keyframe.width * keyframe.height;
+    if (!frame_pixels[id]) {
+        frame_pixels[id] = Graphics::pool_alloc(size);
+        if (!frame_pixels[id]) {
+            return false;
+        }
+    }
+    memcpy(frame_pixels[id], keyframe.pixels, size);
+    Graphics::wrap_surface(&frame, frame_pixels[id], keyframe.width, keyframe.height);
+
+    animation = packed;
+    origin_x = x;
+    origin_y = y;
+    offset = 0;
+    frame_index = 0;
+    fps = rate ? rate : ANIMATION_FPS_DEFAULT;
+    scheduled = false;
+    paused = false;
+    return true;
+}
+
+
+void AnimationPlayer::stop() {
+    animation = nullptr;
+}
+
+
+bool AnimationPlayer::draw() {
+    if (!animation) {
+        return false;
+    }
+    Graphics::blit(&frame, nullptr, origin_x, origin_y, BLIT_OPAQUE);
+    return true;
+}
+
+
+bool AnimationPlayer::is_due(uint32_t now_ms) {
+    return is_active() && (!scheduled || (int32_t)(now_ms - next_frame_ms) >= 0);
+}
+
+
+void AnimationPlayer::step(uint32_t now_ms) {
+    if (!is_due(now_ms)) {
+        return;
+    }
+
+    // Frames follow the clock, not the tick rate; after a pause or a long
+    // stall the schedule restarts instead of racing to catch up.
+    uint32_t frame_ms = 1000 / fps;
+    next_frame_ms += frame_ms;
+    if (!scheduled || (int32_t)(now_ms - next_frame_ms) >= 0) {
+        next_frame_ms = now_ms + frame_ms;
+        if (!scheduled) {
+            scheduled = true;
+            return;
+        }
+    }
+
+    int top, bottom;
+    if (!apply_delta(&top, &bottom)) {
+        return;
+    }
+
+    
+    ClipRect rows = {0, top, frame.width, bottom - top + 1};
+    Graphics::blit(&frame, &rows, origin_x, origin_y + top, BLIT_OPAQUE);
+}
+
+
+bool AnimationPlayer::apply_delta(int* top, int* bottom) {
+    const uint8_t* data = animation->deltas + offset;
+    int rows = *data++;
+    *top = frame.height;
+    *bottom = -1;
+
+    for (int i = 0; i < rows; i++) {
+        int y = *data++;
+        uint8_t* row = frame.pixels + y * frame.pitch;
+        int x = 0;
+        while (true) {
+            int skip = *data++;
+            int length = *data++;
+            if (length == 0) {
+                break;
+            }
+            x += skip;
+            for (int j = 0; j < length; j++) {
+                row[x + j] ^= data[j];
+            }
+            x += length;
+            data += length;
+        }
+
+        if (y < *top) *top = y;
+        if (y > *bottom) *bottom = y;
+    }
+
+    offset = data - animation->deltas;
+    if (++frame_index == animation->frame_count) {
+        frame_index = 0;
+        offset = 0;
+    }
+    return *bottom >= 0;
+}
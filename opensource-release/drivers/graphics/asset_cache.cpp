@@ -0,0 +1,103 @@
+#include "asset_cache.h"
+
+#define RICE_ESCAPE 24
+
+uint8_t* AssetCache::pixels[ASSET_COUNT];
+
+struct BitReader {
+    const uint8_t* data;
+    uint32_t size;
+    uint32_t bit;
+};
+
+static inline int read_bit(BitReader* in) {
+    uint32_t byte = in->bit >> 3;
+    if (byte >= in->size) {
+        return -1;
+    }
+    int value = (in->data[byte] >> (7 - (in->bit & 7))) & 1;
+    in->bit++;
+    return value;
+}
+
+
+bool AssetCache::get(AssetId id, Surface* image) {
+    if (id >= ASSET_COUNT) {
+        return false;
+    }
+
+    const PackedImage* packed = &packed_assets[id];
+    if (!packed->data) {
+        return false;
+    }
+
+    
+    if (!pixels[id]) {
+        uint8_t* buffer = Graphics::pool_alloc(packed->width * packed->height);
+        if (!buffer || !decode(packed, buffer)) {
+            return false;
+        }
+        pixels[id] = buffer;
+    }
+
+    Graphics::wrap_surface(image, pixels[id], packed->width, packed->height);
+    return true;
+}
+
+
+bool AssetCache::decode(const PackedImage* packed, uint8_t* out) {
+    BitReader in = {packed->data, packed->size, 0};
+    int width = packed->width;
+    int total = 4;
+    int count = 1;
+
+    for (int y = 0; y < packed->height; y++) {
+        for (int x = 0; x < width; x++) {
+            
+            int a = x ? out[y * width + x - 1] : (y ? out[(y - 1) * width] : 0);
+            int b = y ? out[(y - 1) * width + x] : a;
+            int c = (x && y) ? out[(y - 1) * width + x - 1] : b;
+            int lo = a < b ? a : b;
+            int hi = a < b ? b : a;
+            int predicted = c >= hi ? lo : (c <= lo ? hi : a + b - c);
+
+            int k = 0;
+            while ((count << k) < total) {
+                k++;
+            }
+
+            
+            uint32_t quotient = 0;
+            int bit = 0;
+            while (quotient < RICE_ESCAPE && (bit = read_bit(&in)) == 1) {
+                quotient++;
+            }
+            if (bit < 0) {
+                return false;
+            }
+
+            int bits = k;
+            uint32_t code = quotient << k;
+            if (quotient == RICE_ESCAPE) {
+                bits = 8;
+                code = 0;
+            }
+            for (int i = bits - 1; i >= 0; i--) {
+                if ((bit = read_bit(&in)) < 0) {
+                    return false;
+                }
+                code |= bit << i;
+            }
+
+            int error = (code & 1) ? -(int)((code + 1) >> 1) : (int)(code >> 1);
+            out[y * width + x] = (uint8_t)(predicted + error);
+
+            total += error < 0 ? -error : error;
+            if (++count == 64) {
+                total >>= 1;
+                count >>= 1;
+            }
+        }
+    }
+    return true;
+}
@@ -1,81 +1,425 @@
 #include "bmp.h"
 #include "graphics.h"
+#include "fat12.h"
 #include "string.h"
 
 BMPHeader BMP::header;
 BMPInfoHeader BMP::info;
 uint8_t* BMP::image_data = nullptr;
+int BMP::image_pitch = 0;
 RGBQuad* BMP::palette = nullptr;
 bool BMP::loaded = false;
 
+static const uint8_t bayer4[16] = {
+     0,  8,  2, 10,
+    12,  4, 14,  6,
+     3, 11,  1,  9,
+    15,  7, 13,  5
+};
+
+static uint8_t* decode_buffer = nullptr;
+
+static uint8_t* get_decode_buffer() {
+    if (!decode_buffer) {
+        decode_buffer = Graphics::pool_alloc(BMP_MAX_PIXELS);
+    }
+    return decode_buffer;
+}
+
+static FAT12Cursor file_cursor;
+static uint8_t preamble[BMP_PREAMBLE_SIZE];
+static uint8_t row_buffer[SCREEN_WIDTH * 4];
+
+
 bool BMP::load_from_memory(const uint8_t* data, uint32_t size) {
-    if (size < sizeof(BMPHeader) + sizeof(BMPInfoHeader)) {
+    if (size < sizeof(BMPHeader) + sizeof(BMPInfoHeader) || !read_headers(data)) {
         return false;
     }
 
+    int width = info.width;
+    int height = info.height < 0 ? -info.height : info.height;
+    int bpp = info.bits_per_pixel;
+
     
-    memcpy(&header, data, sizeof(BMPHeader));
+    bool rle = info.compression == BMP_RLE8 || info.compression == BMP_RLE4;
+    uint32_t stride = ((width * bpp + 31) / 32) * 4;
+    if (header.data_offset > size) {
+        return false;
+    }
+    if (rle ? info.height < 0 : stride * height > size - header.data_offset) {
+        return false;
+    }
+    const uint8_t* pixels = data + header.data_offset;
+
+    uint8_t remap[16] = {};
+    if (!read_color_table(data, size, remap)) {
+        return false;
+    }
+
+    bool decoded = false;
+    if (rle) {
+        decoded = decode_rle(pixels, size - header.data_offset, bpp, remap);
+    } else if (bpp == 8) {
+        
+        if (info.height < 0) {
+            image_data = (uint8_t*)pixels;
+            image_pitch = stride;
+        } else {
+            image_data = (uint8_t*)pixels + (height - 1) * stride;
+            image_pitch = -(int)stride;
+        }
+        decoded = true;
+    } else {
+        decoded = decode_rows(pixels, stride, remap);
+    }
+
+    if (!decoded) {
+        return false;
+    }
+
+    ImageScaler::invalidate(image_data);
+    loaded = true;
+    return true;
+}
+
+
+bool BMP::load_from_file(const char* filename, Surface* target) {
+    if (!FAT12::open_file(filename, &file_cursor)) {
+        return false;
+    }
 
     
-    if (header.signature != 0x4D42) {  
+    uint32_t headers_size = sizeof(BMPHeader) + sizeof(BMPInfoHeader);
+    if (FAT12::read_cursor(&file_cursor, preamble, headers_size) != headers_size) {
+        return false;
+    }
+    if (loaded) {
+        free();
+    }
+    if (!read_headers(preamble)) {
+        return false;
+    }
+
+    int width = info.width;
+    int height = info.height < 0 ? -info.height : info.height;
+    uint32_t stride = ((width * info.bits_per_pixel + 31) / 32) * 4;
+    if (info.compression == BMP_RLE8 || info.compression == BMP_RLE4) {
+        return false;
+    }
+    if (stride > sizeof(row_buffer) || header.data_offset < headers_size) {
         return false;
     }
 
     
-    memcpy(&info, data + sizeof(BMPHeader), sizeof(BMPInfoHeader));
+    uint8_t* dest;
+    int pitch;
+    if (target) {
+        if (target->width < width || target->height < height) {
+            return false;
+        }
+        dest = target->pixels;
+        pitch = target->pitch;
+    } else {
+        dest = get_decode_buffer();
+        pitch = width;
+        if (!dest || width * height > BMP_MAX_PIXELS) {
+            return false;
+        }
+    }
 
     
-    if (info.bits_per_pixel != 8) {
+    uint32_t table_size = header.data_offset;
+    if (table_size > sizeof(preamble)) {
+        table_size = sizeof(preamble);
+    }
+    table_size -= headers_size;
+    if (FAT12::read_cursor(&file_cursor, preamble + headers_size, table_size) != table_size) {
+        return false;
+    }
+    uint32_t gap = header.data_offset - headers_size - table_size;
+    if (FAT12::read_cursor(&file_cursor, nullptr, gap) != gap) {
+        return false;
+    }
+
+    uint8_t remap[16] = {};
+    if (!read_color_table(preamble, headers_size + table_size, remap)) {
         return false;
     }
 
     
-    uint32_t palette_size = 256;
-    if (info.colors_used > 0 && info.colors_used < 256) {
-        palette_size = info.colors_used;
+    for (int row = 0; row < height; row++) {
+        if (FAT12::read_cursor(&file_cursor, row_buffer, stride) != stride) {
+            return false;
+        }
+        int y = info.height < 0 ? row : height - 1 - row;
+        convert_row(row_buffer, dest + y * pitch, y, remap);
     }
 
+    image_data = dest;
+    image_pitch = pitch;
+    ImageScaler::invalidate(image_data);
+    loaded = true;
+    return true;
+}
+
+
+bool BMP::read_headers(const uint8_t* data) {
     
-    const uint8_t* palette_data = data + sizeof(BMPHeader) + info.header_size;
+    memcpy(&header, data, sizeof(BMPHeader));
 
     
-    for (uint32_t i = 0; i < palette_size; i++) {
-        RGBQuad color;
-        memcpy(&color, palette_data + i * sizeof(RGBQuad), sizeof(RGBQuad));
-        Graphics::set_palette(i, color.red, color.green, color.blue);
+    if (header.signature != 0x4D42) {  
+        return false;
     }
 
     
-    image_data = (uint8_t*)(data + header.data_offset);
-    loaded = true;
+    memcpy(&info, data + sizeof(BMPHeader), sizeof(BMPInfoHeader));
+
+    // Every decode path sizes its buffers from these, so bound them before
+    // anything multiplies them together.
+    if (info.width <= 0 || info.width > SCREEN_WIDTH || info.height == 0 ||
+        info.height < -SCREEN_HEIGHT || info.height > SCREEN_HEIGHT) {
+        return false;
+    }
+    if (info.header_size < sizeof(BMPInfoHeader) || info.header_size > 124) {
+        return false;
+    }
 
+    switch (info.bits_per_pixel) {
+        case 8:
+            return info.compression == BMP_RGB || info.compression == BMP_RLE8;
+        case 4:
+            return info.compression == BMP_RGB || info.compression == BMP_RLE4;
+        case 24:
+            return info.compression == BMP_RGB;
+        case 32:
+            return info.compression == BMP_RGB || info.compression == BMP_BITFIELDS;
+        default:
+            return false;
+    }
+}
+
+
+bool BMP::read_color_table(const uint8_t* data, uint32_t size, uint8_t* remap) {
+    const uint8_t* palette_data = data + sizeof(BMPHeader) + info.header_size;
+
+    if (info.bits_per_pixel == 8) {
+        
+        uint32_t palette_size = 256;
+        if (info.colors_used > 0 && info.colors_used < 256) {
+            palette_size = info.colors_used;
+        }
+        if (palette_data + palette_size * sizeof(RGBQuad) > data + size) {
+            return false;
+        }
+
+        
+        uint8_t rgb[256 * 3];
+        for (uint32_t i = 0; i < palette_size; i++) {
+            RGBQuad color;
+            memcpy(&color, palette_data + i * sizeof(RGBQuad), sizeof(RGBQuad));
+            rgb[i * 3] = color.red;
+            rgb[i * 3 + 1] = color.green;
+            rgb[i * 3 + 2] = color.blue;
+        }
+        Graphics::set_palette_range(0, palette_size, rgb);
+    } else if (info.bits_per_pixel == 4) {
+        uint32_t colors = info.colors_used > 0 && info.colors_used < 16 ? info.colors_used : 16;
+        if (palette_data + colors * sizeof(RGBQuad) > data + size) {
+            return false;
+        }
+        for (uint32_t i = 0; i < colors; i++) {
+            RGBQuad color;
+            memcpy(&color, palette_data + i * sizeof(RGBQuad), sizeof(RGBQuad));
+            remap[i] = Graphics::nearest_color(color.red, color.green, color.blue);
+        }
+    } else if (!Graphics::prepare_inverse_palette()) {
+        return false;
+    } else if (info.compression == BMP_BITFIELDS) {
+        
+        if (sizeof(BMPHeader) + 52 > size) {
+            return false;
+        }
+        uint32_t masks[3];
+        memcpy(masks, data + sizeof(BMPHeader) + 40, sizeof(masks));
+        return masks[0] == 0x00FF0000 && masks[1] == 0x0000FF00 && masks[2] == 0x000000FF;
+    }
     return true;
 }
 
-void BMP::draw(int x, int y) {
-    if (!loaded || !image_data) {
+
+bool BMP::decode_rows(const uint8_t* pixels, uint32_t stride, const uint8_t* remap) {
+    int width = info.width;
+    int height = info.height < 0 ? -info.height : info.height;
+    uint8_t* dest = get_decode_buffer();
+    if (!dest || width * height > BMP_MAX_PIXELS) {
+        return false;
+    }
+
+    for (int y = 0; y < height; y++) {
+        const uint8_t* row = pixels + (info.height < 0 ? y : height - 1 - y) * stride;
+        convert_row(row, dest + y * width, y, remap);
+    }
+
+    image_data = dest;
+    image_pitch = width;
+    return true;
+}
+
+
+void BMP::convert_row(const uint8_t* src, uint8_t* out, int y, const uint8_t* remap) {
+    int width = info.width;
+    int bytes_per_pixel = info.bits_per_pixel / 8;
+
+    if (info.bits_per_pixel == 8) {
+        memcpy(out, src, width);
+        return;
+    }
+
+    if (info.bits_per_pixel == 4) {
+        for (int x = 0; x < width; x++) {
+            uint8_t pair = src[x >> 1];
+            out[x] = remap[(x & 1) ? pair & 0x0F : pair >> 4];
+        }
         return;
     }
 
+    
+    const uint8_t* threshold = bayer4 + (y & 3) * 4;
+    for (int x = 0; x < width; x++) {
+        int bias = threshold[x & 3] >> 1;
+        int b = src[0] + bias;
+        int g = src[1] + bias;
+        int r = src[2] + bias;
+        if (b > 255) b = 255;
+        if (g > 255) g = 255;
+        if (r > 255) r = 255;
+        out[x] = Graphics::nearest_rgb555(((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3));
+        src += bytes_per_pixel;
+    }
+}
+
+
+bool BMP::decode_rle(const uint8_t* src, uint32_t length, int bits, const uint8_t* remap) {
     int width = info.width;
     int height = info.height;
+    if (width <= 0 || width > SCREEN_WIDTH || height <= 0 || height > SCREEN_HEIGHT) {
+        return false;
+    }
+    uint8_t* dest = get_decode_buffer();
+    if (!dest) {
+        return false;
+    }
 
     
-    for (int row = 0; row < height; row++) {
-        for (int col = 0; col < width; col++) {
-            
-            int bmp_row = height - 1 - row;
+    memset(dest, 0, width * height);
+    const uint8_t* end = src + length;
+    int x = 0;
+    int y = height - 1;
 
-            
-            int row_size = ((width + 3) / 4) * 4;
-            uint8_t pixel = image_data[bmp_row * row_size + col];
+    // Deltas and end-of-line codes can walk y past the last row, so the row
+    // pointer is only formed once the loop has checked y.
+    while (src + 2 <= end && y >= 0) {
+        uint8_t count = src[0];
+        uint8_t value = src[1];
+        uint8_t* row = dest + y * width;
+        src += 2;
 
-            Graphics::put_pixel(x + col, y + row, pixel);
+        if (count > 0) {
+            
+            int run = count;
+            if (run > width - x) {
+                run = width - x;
+            }
+            if (bits == 8) {
+                memset(row + x, value, run);
+            } else {
+                uint8_t hi = remap[value >> 4];
+                uint8_t lo = remap[value & 0x0F];
+                for (int i = 0; i < run; i++) {
+                    row[x + i] = (i & 1) ? lo : hi;
+                }
+            }
+            x += run;
+        } else if (value == 0) {
+            x = 0;
+            y--;
+        } else if (value == 1) {
+            break;
+        } else if (value == 2) {
+            if (src + 2 > end) {
+                break;
+            }
+            x += src[0];
+            y -= src[1];
+            src += 2;
+            if (x > width) {
+                x = width;
+            }
+        } else {
+            
+            int literal = value;
+            int literal_bytes = bits == 8 ? literal : (literal + 1) >> 1;
+            if (src + literal_bytes > end) {
+                break;
+            }
+            int run = literal;
+            if (run > width - x) {
+                run = width - x;
+            }
+            if (bits == 8) {
+                memcpy(row + x, src, run);
+            } else {
+                for (int i = 0; i < run; i++) {
+                    uint8_t pair = src[i >> 1];
+                    row[x + i] = remap[(i & 1) ? pair & 0x0F : pair >> 4];
+                }
+            }
+            x += run;
+            src += (literal_bytes + 1) & ~1;
         }
     }
+
+    image_data = dest;
+    image_pitch = width;
+    return true;
+}
+
+
+void BMP::wrap(Surface* image) {
+    int height = info.height < 0 ? -info.height : info.height;
+    Graphics::wrap_surface(image, image_data, info.width, height);
+    image->pitch = image_pitch;
+}
+
+
+void BMP::draw(int x, int y) {
+    if (!loaded || !image_data) {
+        return;
+    }
+
+    Surface image;
+    wrap(&image);
+    Graphics::blit(&image, nullptr, x, y, BLIT_OPAQUE);
+}
+
+
+void BMP::draw_scaled(int x, int y, int width, int height, ScaleFilter filter) {
+    if (!loaded || !image_data) {
+        return;
+    }
+
+    Surface image;
+    wrap(&image);
+    ImageScaler::draw(&image, x, y, width, height, filter);
 }
 
 void BMP::free() {
+    if (loaded) {
+        Surface image;
+        wrap(&image);
+        ImageScaler::invalidate(image.pixels);
+    }
     image_data = nullptr;
     palette = nullptr;
     loaded = false;
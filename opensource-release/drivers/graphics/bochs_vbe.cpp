@@ -0,0 +1,102 @@
+#include "bochs_vbe.h"
+#include "io.h"
+
+
+#define PCI_CONFIG_ADDRESS 0xCF8
+#define PCI_CONFIG_DATA    0xCFC
+
+bool BochsVBE::available = false;
+bool BochsVBE::enabled = false;
+uint8_t* BochsVBE::framebuffer = nullptr;
+uint16_t BochsVBE::width = 0;
+uint16_t BochsVBE::height = 0;
+uint8_t BochsVBE::bpp = 0;
+uint32_t BochsVBE::pitch = 0;
+
+
+static uint32_t pci_read(uint8_t bus, uint8_t device, uint8_t function, uint8_t offset) {
+    outl(PCI_CONFIG_ADDRESS, 0x80000000u | ((uint32_t)bus << 16) | ((uint32_t)device << 11) |
+                             ((uint32_t)function << 8) | (offset & 0xFC));
+    return inl(PCI_CONFIG_DATA);
+}
+
+void BochsVBE::write_register(uint16_t index, uint16_t value) {
+    outw(VBE_DISPI_IOPORT_INDEX, index);
+    outw(VBE_DISPI_IOPORT_DATA, value);
+}
+
+uint16_t BochsVBE::read_register(uint16_t index) {
+    outw(VBE_DISPI_IOPORT_INDEX, index);
+    return inw(VBE_DISPI_IOPORT_DATA);
+}
+
+
+uint32_t BochsVBE::find_framebuffer() {
+    for (uint8_t bus = 0; bus < 4; bus++) {
+        for (uint8_t device = 0; device < 32; device++) {
+            uint32_t id = pci_read(bus, device, 0, 0x00);
+            uint16_t vendor = id & 0xFFFF;
+            uint16_t product = id >> 16;
+
+            
+            if ((vendor == 0x1234 && product == 0x1111) || (vendor == 0x80EE && product == 0xBEEF)) {
+                uint32_t bar0 = pci_read(bus, device, 0, 0x10);
+                if (bar0 & 0x01) {
+                    continue;
+                }
+                return bar0 & 0xFFFFFFF0;
+            }
+        }
+    }
+    return VBE_DISPI_LFB_DEFAULT;
+}
+
+bool BochsVBE::detect() {
+    uint16_t id = read_register(VBE_DISPI_INDEX_ID);
+    available = (id >= VBE_DISPI_ID0 && id <= VBE_DISPI_ID5);
+    if (available && !framebuffer) {
+        framebuffer = (uint8_t*)(uintptr_t)find_framebuffer();
+    }
+    return available;
+}
+
+bool BochsVBE::set_mode(uint16_t mode_width, uint16_t mode_height, uint8_t mode_bpp) {
+    if (!available && !detect()) {
+        return false;
+    }
+    if (mode_bpp != 8 && mode_bpp != 32) {
+        return false;
+    }
+
+    write_register(VBE_DISPI_INDEX_ENABLE, VBE_DISPI_DISABLED);
+    write_register(VBE_DISPI_INDEX_XRES, mode_width);
+    write_register(VBE_DISPI_INDEX_YRES, mode_height);
+    write_register(VBE_DISPI_INDEX_BPP, mode_bpp);
+    write_register(VBE_DISPI_INDEX_VIRT_WIDTH, mode_width);
+    write_register(VBE_DISPI_INDEX_X_OFFSET, 0);
+    write_register(VBE_DISPI_INDEX_Y_OFFSET, 0);
+    write_register(VBE_DISPI_INDEX_ENABLE, VBE_DISPI_ENABLED | VBE_DISPI_LFB_ENABLED);
+
+    
+    if (read_register(VBE_DISPI_INDEX_XRES) != mode_width ||
+        read_register(VBE_DISPI_INDEX_YRES) != mode_height ||
+        read_register(VBE_DISPI_INDEX_BPP) != mode_bpp) {
+        disable();
+        return false;
+    }
+
+    width = mode_width;
+    height = mode_height;
+    bpp = mode_bpp;
+    pitch = read_register(VBE_DISPI_INDEX_VIRT_WIDTH) * (mode_bpp / 8);
+    enabled = true;
+    return true;
+}
+
+void BochsVBE::disable() {
+    if (!available) {
+        return;
+    }
+    write_register(VBE_DISPI_INDEX_ENABLE, VBE_DISPI_DISABLED);
+    enabled = false;
+}
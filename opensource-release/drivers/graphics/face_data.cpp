@@ -11,16 +11,20 @@ void generate_face_data(uint8_t* buffer) {
     }
 
     
+    
+    const int scale_x = FACE_HEIGHT * 11 / 10;
+    const int scale_y = FACE_WIDTH * 11 / 10;
+    const int radius = FACE_WIDTH * FACE_HEIGHT / 2;
     for (int y = 0; y < FACE_HEIGHT; y++) {
+        int ny = (y - FACE_HEIGHT / 2) * scale_y;
+        int row_dist = ny * ny;
+
         for (int x = 0; x < FACE_WIDTH; x++) {
             int idx = y * FACE_WIDTH + x;
-
-            float nx = (float)(x - FACE_WIDTH/2) / (FACE_WIDTH/2.2f);
-            float ny = (float)(y - FACE_HEIGHT/2) / (FACE_HEIGHT/2.2f);
-            float dist = (nx * nx) + (ny * ny);
+            int nx = (x - FACE_WIDTH / 2) * scale_x;
 
             
-            if (dist < 1.0f) {
+            if (nx * nx + row_dist < radius * radius) {
                 
                 if ((x * 7 + y * 13) % 4 < 2) {
                     buffer[idx] = 15;  
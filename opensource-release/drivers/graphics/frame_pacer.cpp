@@ -0,0 +1,115 @@
+#include "frame_pacer.h"
+#include "graphics.h"
+#include "palette_animator.h"
+#include "animation_player.h"
+#include "io.h"
+
+
+#define PIT_FREQUENCY 1193182
+#define CALIBRATE_MS 10
+
+uint16_t FramePacer::target_rate = FRAME_RATE_DEFAULT;
+uint32_t FramePacer::cycles_per_ms = 0;
+uint32_t FramePacer::cycles_per_frame = 0;
+uint64_t FramePacer::last_present = 0;
+uint32_t FramePacer::frames_presented = 0;
+uint64_t FramePacer::clock_tsc = 0;
+uint32_t FramePacer::clock_ms = 0;
+
+
+static bool cpu_has_tsc() {
+    uint32_t eax, ebx, ecx, edx;
+    asm volatile("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(1));
+    return (edx & (1 << 4)) != 0;
+}
+
+
+bool FramePacer::calibrate() {
+    if (!cpu_has_tsc()) {
+        return false;
+    }
+
+    const uint16_t latch = PIT_FREQUENCY / (1000 / CALIBRATE_MS);
+
+    
+    uint8_t port61 = inb(0x61);
+    outb(0x61, (port61 & ~0x02) | 0x01);
+    outb(0x43, 0xB0);
+    outb(0x42, latch & 0xFF);
+    outb(0x42, latch >> 8);
+
+    uint64_t start = read_tsc();
+    while (!(inb(0x61) & 0x20));
+    uint64_t end = read_tsc();
+
+    outb(0x61, port61);
+
+    cycles_per_ms = (uint32_t)(end - start) / CALIBRATE_MS;
+    return cycles_per_ms != 0;
+}
+
+void FramePacer::initialize(uint16_t target_hz) {
+    frames_presented = 0;
+    calibrate();
+    set_target_rate(target_hz);
+    last_present = is_calibrated() ? read_tsc() : 0;
+    clock_tsc = last_present;
+}
+
+void FramePacer::set_target_rate(uint16_t hz) {
+    if (hz < FRAME_RATE_MIN) hz = FRAME_RATE_MIN;
+    if (hz > FRAME_RATE_MAX) hz = FRAME_RATE_MAX;
+    target_rate = hz;
+
+    
+    cycles_per_frame = (cycles_per_ms / hz) * 1000 + ((cycles_per_ms % hz) * 1000) / hz;
+}
+
+
+// Keeps a millisecond clock for animations: TSC time when calibrated,
+// otherwise the 18.2 Hz PIT wraps the caller counts.
+void FramePacer::update_clock(uint32_t pit_ticks) {
+    if (!is_calibrated()) {
+        clock_ms = pit_ticks * PIT_TICK_MS;
+        return;
+    }
+
+    uint64_t elapsed = read_tsc() - clock_tsc;
+    if (elapsed < cycles_per_ms) {
+        return;
+    }
+    uint32_t ms = elapsed >> 32 ? 0xFFFFFFFFu / cycles_per_ms : (uint32_t)elapsed / cycles_per_ms;
+    clock_ms += ms;
+    clock_tsc += (uint64_t)ms * cycles_per_ms;
+}
+
+
+bool FramePacer::tick(uint32_t pit_ticks) {
+    update_clock(pit_ticks);
+
+    bool animating = PaletteAnimator::is_active();
+    bool playing = AnimationPlayer::is_due(clock_ms);
+    if (!Graphics::has_damage() && !animating && !playing) {
+        return false;
+    }
+
+    if (is_calibrated()) {
+        uint64_t now = read_tsc();
+        if (now - last_present < cycles_per_frame) {
+            return false;
+        }
+        last_present = now;
+    }
+
+    if (animating) {
+        PaletteAnimator::step();
+    }
+    if (playing) {
+        AnimationPlayer::step(clock_ms);
+    }
+    if (Graphics::has_damage()) {
+        Graphics::present();
+    }
+    frames_presented++;
+    return true;
+}
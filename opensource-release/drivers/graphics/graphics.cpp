@@ -1,8 +1,86 @@
 #include "graphics.h"
+#include "bochs_vbe.h"
+#include "span_kernels.h"
 #include "io.h"
+#include "string.h"
+
+static uint8_t back_buffer_storage[SCREEN_WIDTH * SCREEN_HEIGHT] __attribute__((aligned(16)));
 
 uint8_t* Graphics::video_memory = (uint8_t*)0xA0000;
+uint8_t* Graphics::back_buffer = back_buffer_storage;
 bool Graphics::is_graphics_mode = false;
+VideoMode Graphics::video_mode = VIDEO_MODE_TEXT;
+PresentMode Graphics::present_mode = PRESENT_IMMEDIATE;
+uint8_t Graphics::palette_shadow[256 * 3];
+uint32_t Graphics::palette_rgb[256];
+uint32_t Graphics::palette_generation = 1;
+Surface Graphics::screen = {
+    back_buffer_storage, SCREEN_WIDTH, SCREEN_WIDTH, SCREEN_HEIGHT, PIXEL_FORMAT_INDEXED8, 0, 0,
+    {{0, 0, SCREEN_WIDTH, SCREEN_HEIGHT}}, 1
+};
+Surface* Graphics::target = &Graphics::screen;
+Surface Graphics::lfb_surface;
+const Surface* Graphics::overlay_sprite = nullptr;
+int Graphics::overlay_key = BLIT_OPAQUE;
+int Graphics::overlay_x = 0;
+int Graphics::overlay_y = 0;
+bool Graphics::overlay_visible = false;
+Surface Graphics::overlay_save;
+int16_t Graphics::dirty_x0[CANVAS_MAX_HEIGHT];
+int16_t Graphics::dirty_x1[CANVAS_MAX_HEIGHT];
+int Graphics::dirty_top = SCREEN_HEIGHT;
+int Graphics::dirty_bottom = 0;
+int Graphics::page_count = 1;
+int Graphics::visible_page = 0;
+int Graphics::pending_page = -1;
+int Graphics::display_width = SCREEN_WIDTH;
+int Graphics::display_height = SCREEN_HEIGHT;
+int Graphics::lfb_scale = 1;
+int Graphics::lfb_x = 0;
+int Graphics::lfb_y = 0;
+int16_t Graphics::page_dirty_x0[MODEX_MAX_PAGES][MODEX_MAX_HEIGHT];
+int16_t Graphics::page_dirty_x1[MODEX_MAX_PAGES][MODEX_MAX_HEIGHT];
+int Graphics::page_dirty_top[MODEX_MAX_PAGES];
+int Graphics::page_dirty_bottom[MODEX_MAX_PAGES];
+
+static uint32_t lfb_line[LFB_MAX_WIDTH];
+static uint8_t* large_canvas = nullptr;
+
+
+static uint32_t pool_used = 0;
+static uint32_t pool_size = 0;
+
+
+uint8_t* Graphics::pool_alloc(uint32_t size) {
+    size = (size + 15) & ~15u;
+    if (pool_used + size > pool_size) {
+        return nullptr;
+    }
+    uint8_t* block = (uint8_t*)(uintptr_t)(GRAPHICS_POOL_BASE + pool_used);
+    pool_used += size;
+    return block;
+}
+
+
+static uint8_t* blend_tables[BLEND_LEVEL_COUNT];
+static uint32_t blend_generation[BLEND_LEVEL_COUNT];
+static uint8_t gray_index[256];
+static uint8_t* rgb555_index;
+static uint32_t rgb555_valid[32768 / 32];
+static uint32_t inverse_generation;
+static bool palette_is_gray;
+
+static uint8_t overlay_save_pixels[OVERLAY_MAX_SIZE * OVERLAY_MAX_SIZE];
+
+
+static inline void copy_span(uint8_t* dest, const uint8_t* src, uint32_t count) {
+    SpanKernels::table.copy(dest, src, count);
+}
+
+
+static inline void fill_span(uint8_t* dest, uint8_t color, uint32_t count) {
+    SpanKernels::table.fill(dest, color, count);
+}
 
 
 static void write_registers(const uint8_t *regs) {
@@ -71,6 +149,46 @@ static const uint8_t g_320x200x256[] = {
 };
 
 
+static const uint8_t g_320x200x256_modex[] = {
+    
+    0x63,
+    
+    0x03, 0x01, 0x0F, 0x00, 0x06,
+    
+    0x5F, 0x4F, 0x50, 0x82, 0x54, 0x80, 0xBF, 0x1F,
+    0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9C, 0x0E, 0x8F, 0x28, 0x00, 0x96, 0xB9, 0xE3,
+    0xFF,
+    
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x0F,
+    0xFF,
+    
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x41, 0x00, 0x0F, 0x00, 0x00
+};
+
+
+static const uint8_t g_320x240x256_modex[] = {
+    
+    0xE3,
+    
+    0x03, 0x01, 0x0F, 0x00, 0x06,
+    
+    0x5F, 0x4F, 0x50, 0x82, 0x54, 0x80, 0x0D, 0x3E,
+    0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xEA, 0xAC, 0xDF, 0x28, 0x00, 0xE7, 0x06, 0xE3,
+    0xFF,
+    
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x0F,
+    0xFF,
+    
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x41, 0x00, 0x0F, 0x00, 0x00
+};
+
+
 static const uint8_t g_80x25_text[] = {
     
     0x67,
@@ -90,271 +208,1481 @@ static const uint8_t g_80x25_text[] = {
     0x0C, 0x00, 0x0F, 0x08, 0x00
 };
 
-void Graphics::initialize() {
+// memory_end is the first physical address past the RAM above 1 MB. The
+// pool only uses what is really there; on a small machine pool_alloc
+// returns nullptr and callers fall back to their static buffers.
+void Graphics::initialize(uint32_t memory_end) {
     
     is_graphics_mode = false;
+
+    pool_size = 0;
+    if (memory_end > GRAPHICS_POOL_BASE) {
+        pool_size = memory_end - GRAPHICS_POOL_BASE;
+        if (pool_size > GRAPHICS_POOL_SIZE) pool_size = GRAPHICS_POOL_SIZE;
+    }
+
+    for (int y = 0; y < CANVAS_MAX_HEIGHT; y++) {
+        dirty_x0[y] = SCREEN_WIDTH;
+        dirty_x1[y] = 0;
+    }
+    dirty_top = SCREEN_HEIGHT;
+    dirty_bottom = 0;
+}
+
+
+// Points the screen surface at a canvas of the given size and queues all
+// of it for the next present. Panels and clip state are the caller's to rebuild.
+void Graphics::set_canvas(uint8_t* pixels, int width, int height) {
+    for (int y = 0; y < CANVAS_MAX_HEIGHT; y++) {
+        dirty_x0[y] = width;
+        dirty_x1[y] = 0;
+    }
+    dirty_top = height;
+    dirty_bottom = 0;
+
+    back_buffer = pixels;
+    wrap_surface(&screen, pixels, width, height);
+    target = &screen;
+    mark_dirty(0, 0, width, height);
 }
 
 
 static void setup_grayscale_palette() {
-    
-    
+    uint8_t rgb[256 * 3];
     for (int i = 0; i < 256; i++) {
-        Graphics::set_palette(i, i, i, i);
+        rgb[i * 3] = i;
+        rgb[i * 3 + 1] = i;
+        rgb[i * 3 + 2] = i;
     }
+    Graphics::set_palette_range(0, 256, rgb);
 }
 
 void Graphics::set_mode_text() {
+    BochsVBE::disable();
     write_registers(g_80x25_text);
     is_graphics_mode = false;
+    video_mode = VIDEO_MODE_TEXT;
+}
+
+static void set_map_mask(uint8_t planes) {
+    outb(0x3C4, 0x02);
+    outb(0x3C5, planes);
 }
 
 void Graphics::set_mode_graphics() {
+    BochsVBE::disable();
     write_registers(g_320x200x256);
     is_graphics_mode = true;
+    video_mode = VIDEO_MODE_13H;
+    page_count = 1;
+    visible_page = 0;
+    display_width = SCREEN_WIDTH;
+    display_height = SCREEN_HEIGHT;
+    set_canvas(back_buffer_storage, SCREEN_WIDTH, SCREEN_HEIGHT);
 
     
     setup_grayscale_palette();
 }
 
+
+void Graphics::set_mode_x(int height) {
+    // The static back buffer only holds 200 lines; without pool room for a
+    // taller canvas, stay on the 200-line timings.
+    if (height == 240 && !large_canvas) {
+        large_canvas = pool_alloc(CANVAS_MAX_WIDTH * CANVAS_MAX_HEIGHT);
+    }
+    if (!large_canvas) {
+        height = SCREEN_HEIGHT;
+    }
+
+    BochsVBE::disable();
+    if (height == 240) {
+        write_registers(g_320x240x256_modex);
+        page_count = 3;
+    } else {
+        write_registers(g_320x200x256_modex);
+        height = SCREEN_HEIGHT;
+        page_count = 4;
+    }
+    is_graphics_mode = true;
+    video_mode = VIDEO_MODE_X;
+    display_width = SCREEN_WIDTH;
+    display_height = height;
+    visible_page = 0;
+    pending_page = -1;
+    set_canvas(height == SCREEN_HEIGHT ? back_buffer_storage : large_canvas, SCREEN_WIDTH, height);
+
+    
+    set_map_mask(0x0F);
+    fill_span(video_memory, 0, 0x10000);
+
+    for (int page = 0; page < MODEX_MAX_PAGES; page++) {
+        for (int y = 0; y < MODEX_MAX_HEIGHT; y++) {
+            page_dirty_x0[page][y] = SCREEN_WIDTH;
+            page_dirty_x1[page][y] = 0;
+        }
+        page_dirty_top[page] = MODEX_MAX_HEIGHT;
+        page_dirty_bottom[page] = 0;
+    }
+
+    setup_grayscale_palette();
+}
+
+
+bool Graphics::set_mode_lfb(uint16_t width, uint16_t height, uint8_t bpp) {
+    if (width < SCREEN_WIDTH || height < SCREEN_HEIGHT || width > LFB_MAX_WIDTH) {
+        return false;
+    }
+    if (!BochsVBE::set_mode(width, height, bpp)) {
+        return false;
+    }
+
+    is_graphics_mode = true;
+    video_mode = VIDEO_MODE_LFB;
+    page_count = 1;
+    visible_page = 0;
+    display_width = width;
+    display_height = height;
+
+    // Draw at the native resolution, up to the canvas limit. Without pool
+    // room for the big canvas, fall back to scaling up the 320x200 one.
+    if (!large_canvas) {
+        large_canvas = pool_alloc(CANVAS_MAX_WIDTH * CANVAS_MAX_HEIGHT);
+    }
+    if (large_canvas) {
+        set_canvas(large_canvas, width < CANVAS_MAX_WIDTH ? width : CANVAS_MAX_WIDTH,
+                   height < CANVAS_MAX_HEIGHT ? height : CANVAS_MAX_HEIGHT);
+    } else {
+        set_canvas(back_buffer_storage, SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+
+    int scale_x = width / screen.width;
+    int scale_y = height / screen.height;
+    lfb_scale = scale_x < scale_y ? scale_x : scale_y;
+    lfb_x = (width - screen.width * lfb_scale) / 2;
+    lfb_y = (height - screen.height * lfb_scale) / 2;
+
+    lfb_surface.pixels = BochsVBE::get_framebuffer();
+    lfb_surface.pitch = BochsVBE::get_pitch();
+    lfb_surface.width = width;
+    lfb_surface.height = height;
+    lfb_surface.format = bpp == 32 ? PIXEL_FORMAT_XRGB32 : PIXEL_FORMAT_INDEXED8;
+
+    setup_grayscale_palette();
+    return true;
+}
+
+void Graphics::set_target(Surface* surface) {
+    if (!surface || surface->format != PIXEL_FORMAT_INDEXED8) {
+        surface = &screen;
+    }
+    target = surface;
+}
+
+
+bool Graphics::create_surface(Surface* surface, int x, int y, int width, int height) {
+    int pitch = (width + 3) & ~3;
+    uint32_t size = pitch * height;
+    uint8_t* pixels = width > 0 && height > 0 ? pool_alloc(size) : nullptr;
+    if (!pixels) {
+        return false;
+    }
+
+    wrap_surface(surface, pixels, width, height);
+    surface->pitch = pitch;
+    surface->origin_x = x;
+    surface->origin_y = y;
+
+    fill_span(surface->pixels, 0, size);
+    return true;
+}
+
+
+void Graphics::wrap_surface(Surface* surface, uint8_t* pixels, int width, int height) {
+    surface->pixels = pixels;
+    surface->pitch = width;
+    surface->width = width;
+    surface->height = height;
+    surface->format = PIXEL_FORMAT_INDEXED8;
+    surface->origin_x = 0;
+    surface->origin_y = 0;
+    surface->clip_stack[0].x = 0;
+    surface->clip_stack[0].y = 0;
+    surface->clip_stack[0].width = width;
+    surface->clip_stack[0].height = height;
+    surface->clip_depth = 1;
+}
+
+void Graphics::push_clip(int x, int y, int width, int height) {
+    const ClipRect& top = target->clip_stack[target->clip_depth - 1];
+    int x0 = x - target->origin_x;
+    int y0 = y - target->origin_y;
+    int x1 = x0 + width;
+    int y1 = y0 + height;
+    if (x0 < top.x) x0 = top.x;
+    if (y0 < top.y) y0 = top.y;
+    if (x1 > top.x + top.width) x1 = top.x + top.width;
+    if (y1 > top.y + top.height) y1 = top.y + top.height;
+    if (x1 < x0) x1 = x0;
+    if (y1 < y0) y1 = y0;
+
+    
+    if (target->clip_depth == SURFACE_CLIP_DEPTH) {
+        target->clip_depth--;
+    }
+    ClipRect& clip = target->clip_stack[target->clip_depth++];
+    clip.x = x0;
+    clip.y = y0;
+    clip.width = x1 - x0;
+    clip.height = y1 - y0;
+}
+
+void Graphics::pop_clip() {
+    if (target->clip_depth > 1) {
+        target->clip_depth--;
+    }
+}
+
+
+void Graphics::blit_surface(const Surface* source) {
+    blit(source, nullptr, source->origin_x, source->origin_y, BLIT_OPAQUE);
+}
+
+
+void Graphics::blit(const Surface* source, const ClipRect* rect, int x, int y, int colorkey) {
+    blit_rows(source, rect, x, y, colorkey, nullptr);
+}
+
+void Graphics::blend_blit(const Surface* source, const ClipRect* rect, int x, int y, int colorkey,
+                          BlendLevel level) {
+    const uint8_t* table = get_blend_table(level);
+    if (table) {
+        blit_rows(source, rect, x, y, colorkey, table);
+    }
+}
+
+
+void Graphics::blit_rows(const Surface* source, const ClipRect* rect, int x, int y, int colorkey,
+                         const uint8_t* table) {
+    int sx = 0;
+    int sy = 0;
+    int width = source->width;
+    int height = source->height;
+    if (rect) {
+        sx = rect->x < 0 ? 0 : rect->x;
+        sy = rect->y < 0 ? 0 : rect->y;
+        width = (rect->x + rect->width > source->width ? source->width : rect->x + rect->width) - sx;
+        height = (rect->y + rect->height > source->height ? source->height : rect->y + rect->height) - sy;
+        x += sx - rect->x;
+        y += sy - rect->y;
+    }
+
+    
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    x -= target->origin_x;
+    y -= target->origin_y;
+    int x0 = x < clip.x ? clip.x : x;
+    int y0 = y < clip.y ? clip.y : y;
+    int x1 = x + width > clip.x + clip.width ? clip.x + clip.width : x + width;
+    int y1 = y + height > clip.y + clip.height ? clip.y + clip.height : y + height;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    const uint8_t* src = source->pixels + (sy + y0 - y) * source->pitch + (sx + x0 - x);
+    uint8_t* dest = target->pixels + y0 * target->pitch + x0;
+    int span = x1 - x0;
+    if (table) {
+        for (int row = y0; row < y1; row++) {
+            for (int col = 0; col < span; col++) {
+                if (src[col] != colorkey) {
+                    dest[col] = table[(src[col] << 8) | dest[col]];
+                }
+            }
+            src += source->pitch;
+            dest += target->pitch;
+        }
+    } else if (colorkey < 0) {
+        for (int row = y0; row < y1; row++) {
+            copy_span(dest, src, span);
+            src += source->pitch;
+            dest += target->pitch;
+        }
+    } else {
+        uint8_t key = (uint8_t)colorkey;
+        for (int row = y0; row < y1; row++) {
+            SpanKernels::table.copy_keyed(dest, src, span, key);
+            src += source->pitch;
+            dest += target->pitch;
+        }
+    }
+
+    touch(x0, y0, span, y1 - y0);
+}
+
+
+void Graphics::save_under(Surface* store, int x, int y) {
+    store->origin_x = x;
+    store->origin_y = y;
+
+    x -= target->origin_x;
+    y -= target->origin_y;
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + store->width > target->width ? target->width : x + store->width;
+    int y1 = y + store->height > target->height ? target->height : y + store->height;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    const uint8_t* src = target->pixels + y0 * target->pitch + x0;
+    uint8_t* dest = store->pixels + (y0 - y) * store->pitch + (x0 - x);
+    for (int row = y0; row < y1; row++) {
+        copy_span(dest, src, x1 - x0);
+        src += target->pitch;
+        dest += store->pitch;
+    }
+}
+
+void Graphics::restore_under(const Surface* store) {
+    blit(store, nullptr, store->origin_x, store->origin_y, BLIT_OPAQUE);
+}
+
 void Graphics::put_pixel(int x, int y, uint8_t color) {
-    if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= SCREEN_HEIGHT) {
+    x -= target->origin_x;
+    y -= target->origin_y;
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    if (x < clip.x || x >= clip.x + clip.width || y < clip.y || y >= clip.y + clip.height) {
         return;
     }
-    video_memory[y * SCREEN_WIDTH + x] = color;
+    target->pixels[y * target->pitch + x] = color;
+
+    if (target == &screen) {
+        if (x < dirty_x0[y]) dirty_x0[y] = x;
+        if (x >= dirty_x1[y]) dirty_x1[y] = x + 1;
+        if (y < dirty_top) dirty_top = y;
+        if (y >= dirty_bottom) dirty_bottom = y + 1;
+    }
 }
 
 uint8_t Graphics::get_pixel(int x, int y) {
-    if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= SCREEN_HEIGHT) {
+    x -= target->origin_x;
+    y -= target->origin_y;
+    if (x < 0 || x >= target->width || y < 0 || y >= target->height) {
         return 0;
     }
-    return video_memory[y * SCREEN_WIDTH + x];
+    return target->pixels[y * target->pitch + x];
 }
 
 void Graphics::draw_rect(int x, int y, int width, int height, uint8_t color) {
-    for (int dy = 0; dy < height; dy++) {
-        for (int dx = 0; dx < width; dx++) {
-            put_pixel(x + dx, y + dy, color);
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    x -= target->origin_x;
+    y -= target->origin_y;
+    int x0 = x < clip.x ? clip.x : x;
+    int y0 = y < clip.y ? clip.y : y;
+    int x1 = x + width > clip.x + clip.width ? clip.x + clip.width : x + width;
+    int y1 = y + height > clip.y + clip.height ? clip.y + clip.height : y + height;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    uint8_t* row = target->pixels + y0 * target->pitch + x0;
+    uint32_t span = x1 - x0;
+    if ((int)span == target->pitch) {
+        fill_span(row, color, span * (y1 - y0));
+    } else {
+        for (int r = y0; r < y1; r++) {
+            fill_span(row, color, span);
+            row += target->pitch;
+        }
+    }
+
+    touch(x0, y0, x1 - x0, y1 - y0);
+}
+
+void Graphics::scroll_region(int x, int y, int width, int height, int dy, uint8_t fill) {
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    x -= target->origin_x;
+    y -= target->origin_y;
+    int x0 = x < clip.x ? clip.x : x;
+    int y0 = y < clip.y ? clip.y : y;
+    int x1 = x + width > clip.x + clip.width ? clip.x + clip.width : x + width;
+    int y1 = y + height > clip.y + clip.height ? clip.y + clip.height : y + height;
+    if (x0 >= x1 || y0 >= y1 || dy == 0) {
+        return;
+    }
+
+    uint32_t span = x1 - x0;
+    int rows = y1 - y0;
+    int distance = dy < 0 ? -dy : dy;
+    if (distance < rows) {
+        
+        int pitch = target->pitch;
+        if (dy < 0) {
+            uint8_t* dest = target->pixels + y0 * pitch + x0;
+            for (int row = y0; row < y1 - distance; row++) {
+                copy_span(dest, dest + distance * pitch, span);
+                dest += pitch;
+            }
+        } else {
+            uint8_t* dest = target->pixels + (y1 - 1) * pitch + x0;
+            for (int row = y1 - 1; row >= y0 + distance; row--) {
+                copy_span(dest, dest - distance * pitch, span);
+                dest -= pitch;
+            }
         }
+    } else {
+        distance = rows;
+    }
+
+    uint8_t* exposed = target->pixels + (dy < 0 ? y1 - distance : y0) * target->pitch + x0;
+    for (int row = 0; row < distance; row++) {
+        fill_span(exposed, fill, span);
+        exposed += target->pitch;
     }
+
+    touch(x0, y0, span, rows);
 }
 
 void Graphics::clear_screen(uint8_t color) {
-    for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
-        video_memory[i] = color;
+    fill_span(target->pixels, color, target->pitch * target->height);
+    touch(0, 0, target->width, target->height);
+}
+
+
+void Graphics::fill_hspan(int x0, int x1, int y, uint8_t color) {
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    if (y < clip.y || y >= clip.y + clip.height) {
+        return;
+    }
+    if (x0 < clip.x) x0 = clip.x;
+    if (x1 > clip.x + clip.width) x1 = clip.x + clip.width;
+    if (x0 < x1) {
+        fill_span(target->pixels + y * target->pitch + x0, color, x1 - x0);
+    }
+}
+
+void Graphics::plot(int x, int y, uint8_t color) {
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    if (x >= clip.x && x < clip.x + clip.width && y >= clip.y && y < clip.y + clip.height) {
+        target->pixels[y * target->pitch + x] = color;
+    }
+}
+
+void Graphics::draw_hline(int x, int y, int length, uint8_t color) {
+    draw_rect(x, y, length, 1, color);
+}
+
+void Graphics::draw_vline(int x, int y, int length, uint8_t color) {
+    draw_rect(x, y, 1, length, color);
+}
+
+void Graphics::draw_outline(int x, int y, int width, int height, uint8_t color) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    draw_rect(x, y, width, 1, color);
+    draw_rect(x, y + height - 1, width, 1, color);
+    draw_rect(x, y + 1, 1, height - 2, color);
+    draw_rect(x + width - 1, y + 1, 1, height - 2, color);
+}
+
+
+void Graphics::draw_line(int x0, int y0, int x1, int y1, uint8_t color) {
+    if (y0 == y1) {
+        draw_hline(x0 < x1 ? x0 : x1, y0, (x0 < x1 ? x1 - x0 : x0 - x1) + 1, color);
+        return;
+    }
+    if (x0 == x1) {
+        draw_vline(x0, y0 < y1 ? y0 : y1, (y0 < y1 ? y1 - y0 : y0 - y1) + 1, color);
+        return;
+    }
+
+    
+    if (y0 > y1) {
+        int t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+    x0 -= target->origin_x;
+    x1 -= target->origin_x;
+    y0 -= target->origin_y;
+    y1 -= target->origin_y;
+
+    int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int dy = y1 - y0;
+    int sx = x1 > x0 ? 1 : -1;
+
+    if (dx >= dy) {
+        int error = dx / 2;
+        int run_start = x0;
+        int y = y0;
+        for (int x = x0; ; x += sx) {
+            error -= dy;
+            bool last = x == x1;
+            if (error < 0 || last) {
+                if (sx > 0) {
+                    fill_hspan(run_start, x + 1, y, color);
+                } else {
+                    fill_hspan(x, run_start + 1, y, color);
+                }
+                if (last) break;
+                error += dx;
+                y++;
+                run_start = x + sx;
+            }
+        }
+    } else {
+        int error = dy / 2;
+        int x = x0;
+        for (int y = y0; y <= y1; y++) {
+            plot(x, y, color);
+            error -= dx;
+            if (error < 0) {
+                error += dy;
+                x += sx;
+            }
+        }
+    }
+
+    int left = x0 < x1 ? x0 : x1;
+    touch(left, y0, dx + 1, dy + 1);
+}
+
+
+void Graphics::draw_circle(int cx, int cy, int radius, uint8_t color) {
+    if (radius < 0) {
+        return;
+    }
+    cx -= target->origin_x;
+    cy -= target->origin_y;
+
+    int x = radius;
+    int y = 0;
+    int error = 1 - radius;
+    while (x >= y) {
+        plot(cx + x, cy + y, color);
+        plot(cx - x, cy + y, color);
+        plot(cx + x, cy - y, color);
+        plot(cx - x, cy - y, color);
+        plot(cx + y, cy + x, color);
+        plot(cx - y, cy + x, color);
+        plot(cx + y, cy - x, color);
+        plot(cx - y, cy - x, color);
+
+        y++;
+        if (error < 0) {
+            error += 2 * y + 1;
+        } else {
+            x--;
+            error += 2 * (y - x) + 1;
+        }
+    }
+
+    touch(cx - radius, cy - radius, radius * 2 + 1, radius * 2 + 1);
+}
+
+void Graphics::fill_circle(int cx, int cy, int radius, uint8_t color) {
+    if (radius < 0) {
+        return;
+    }
+    cx -= target->origin_x;
+    cy -= target->origin_y;
+
+    
+    int x = radius;
+    int y = 0;
+    int error = 1 - radius;
+    while (x >= y) {
+        fill_hspan(cx - x, cx + x + 1, cy + y, color);
+        if (y != 0) {
+            fill_hspan(cx - x, cx + x + 1, cy - y, color);
+        }
+
+        y++;
+        if (error < 0) {
+            error += 2 * y + 1;
+        } else {
+            if (x >= y) {
+                fill_hspan(cx - y + 1, cx + y, cy + x, color);
+                fill_hspan(cx - y + 1, cx + y, cy - x, color);
+            }
+            x--;
+            error += 2 * (y - x) + 1;
+        }
+    }
+
+    touch(cx - radius, cy - radius, radius * 2 + 1, radius * 2 + 1);
+}
+
+
+void Graphics::fill_polygon(const Point* points, int count, uint8_t color) {
+    if (count < 3) {
+        return;
+    }
+
+    int top = points[0].y;
+    int bottom = points[0].y;
+    int left = points[0].x;
+    int right = points[0].x;
+    for (int i = 1; i < count; i++) {
+        if (points[i].y < top) top = points[i].y;
+        if (points[i].y > bottom) bottom = points[i].y;
+        if (points[i].x < left) left = points[i].x;
+        if (points[i].x > right) right = points[i].x;
+    }
+
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    int y_begin = top - target->origin_y;
+    int y_end = bottom - target->origin_y;
+    if (y_begin < clip.y) y_begin = clip.y;
+    if (y_end > clip.y + clip.height) y_end = clip.y + clip.height;
+
+    
+    for (int y = y_begin; y < y_end; y++) {
+        int sample = y + target->origin_y;
+        int span_left = 0x7FFFFFFF;
+        int span_right = -0x7FFFFFFF;
+        for (int i = 0; i < count; i++) {
+            const Point* a = &points[i];
+            const Point* b = &points[i + 1 == count ? 0 : i + 1];
+            if (a->y > b->y) {
+                const Point* t = a; a = b; b = t;
+            }
+            if (sample < a->y || sample >= b->y) {
+                continue;
+            }
+
+            int x = a->x * 256 + (2 * (sample - a->y) + 1) * (b->x - a->x) * 128 / (b->y - a->y);
+            if (x < span_left) span_left = x;
+            if (x > span_right) span_right = x;
+        }
+
+        if (span_left <= span_right) {
+            int x0 = ((span_left + 127) >> 8) - target->origin_x;
+            int x1 = ((span_right + 127) >> 8) - target->origin_x;
+            fill_hspan(x0, x1, y, color);
+        }
+    }
+
+    touch(left - target->origin_x, top - target->origin_y, right - left + 1, bottom - top + 1);
+}
+
+void Graphics::set_overlay(const Surface* sprite, int colorkey) {
+    if (overlay_visible && overlay_sprite) {
+        mark_dirty(overlay_x, overlay_y, overlay_sprite->width, overlay_sprite->height);
+    }
+
+    overlay_sprite = sprite;
+    overlay_key = colorkey;
+    overlay_visible = sprite && sprite->width <= OVERLAY_MAX_SIZE && sprite->height <= OVERLAY_MAX_SIZE;
+    if (overlay_visible) {
+        wrap_surface(&overlay_save, overlay_save_pixels, sprite->width, sprite->height);
+        mark_dirty(overlay_x, overlay_y, sprite->width, sprite->height);
+    }
+}
+
+void Graphics::move_overlay(int x, int y) {
+    if (x == overlay_x && y == overlay_y) {
+        return;
+    }
+
+    
+    if (overlay_visible) {
+        mark_dirty(overlay_x, overlay_y, overlay_sprite->width, overlay_sprite->height);
+        mark_dirty(x, y, overlay_sprite->width, overlay_sprite->height);
+    }
+    overlay_x = x;
+    overlay_y = y;
+}
+
+void Graphics::hide_overlay() {
+    if (overlay_visible) {
+        mark_dirty(overlay_x, overlay_y, overlay_sprite->width, overlay_sprite->height);
+    }
+    overlay_visible = false;
+}
+
+
+void Graphics::stamp_overlay() {
+    Surface canvas = screen;
+    Surface* previous = target;
+    target = &canvas;
+    save_under(&overlay_save, overlay_x, overlay_y);
+    blit(overlay_sprite, nullptr, overlay_x, overlay_y, overlay_key);
+    target = previous;
+}
+
+void Graphics::erase_overlay() {
+    Surface canvas = screen;
+    Surface* previous = target;
+    target = &canvas;
+    restore_under(&overlay_save);
+    target = previous;
+}
+
+
+void Graphics::mark_dirty(int x, int y, int width, int height) {
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + width > screen.width ? screen.width : x + width;
+    int y1 = y + height > screen.height ? screen.height : y + height;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    for (int row = y0; row < y1; row++) {
+        if (x0 < dirty_x0[row]) dirty_x0[row] = x0;
+        if (x1 > dirty_x1[row]) dirty_x1[row] = x1;
+    }
+    if (y0 < dirty_top) dirty_top = y0;
+    if (y1 > dirty_bottom) dirty_bottom = y1;
+}
+
+
+void Graphics::set_present_mode(PresentMode mode) {
+    present_mode = mode;
+}
+
+
+void Graphics::wait_vertical_retrace() {
+    while (inb(0x3DA) & 0x08);
+    while (!(inb(0x3DA) & 0x08));
+}
+
+
+// A start address written during active display latches at the next
+// vertical retrace, so seeing the retrace bit means the pending flip is on
+// screen. Cheap enough to call from the main loop every iteration.
+void Graphics::poll_retrace() {
+    if (pending_page >= 0 && (inb(0x3DA) & 0x08)) {
+        pending_page = -1;
+    }
+}
+
+
+void Graphics::present() {
+    if (!is_graphics_mode || !has_damage()) {
+        return;
+    }
+
+    
+    if (overlay_visible) {
+        stamp_overlay();
+    }
+
+    if (video_mode == VIDEO_MODE_X) {
+        present_planar();
+    } else {
+        if (present_mode == PRESENT_VSYNC) {
+            wait_vertical_retrace();
+        }
+
+        if (video_mode == VIDEO_MODE_LFB) {
+            present_lfb();
+        } else {
+            for (int row = dirty_top; row < dirty_bottom; row++) {
+                int x0 = dirty_x0[row];
+                int x1 = dirty_x1[row];
+                if (x0 < x1) {
+                    int offset = row * screen.pitch + x0;
+                    copy_span(video_memory + offset, back_buffer + offset, x1 - x0);
+                }
+            }
+        }
+    }
+
+    if (overlay_visible) {
+        erase_overlay();
+    }
+
+    for (int row = dirty_top; row < dirty_bottom; row++) {
+        dirty_x0[row] = screen.width;
+        dirty_x1[row] = 0;
+    }
+    dirty_top = screen.height;
+    dirty_bottom = 0;
+}
+
+
+void Graphics::present_planar() {
+    // Until the last flip has latched the CRTC may still be scanning the
+    // page before it, which is the one the next target would overwrite.
+    if (pending_page >= 0) {
+        while (!(inb(0x3DA) & 0x08));
+        pending_page = -1;
+    }
+    int target = (visible_page + 1) % page_count;
+
+    
+    for (int page = 0; page < page_count; page++) {
+        int16_t* x0 = page_dirty_x0[page];
+        int16_t* x1 = page_dirty_x1[page];
+        for (int row = dirty_top; row < dirty_bottom; row++) {
+            if (dirty_x0[row] < dirty_x1[row]) {
+                if (dirty_x0[row] < x0[row]) x0[row] = dirty_x0[row];
+                if (dirty_x1[row] > x1[row]) x1[row] = dirty_x1[row];
+            }
+        }
+        if (dirty_top < page_dirty_top[page]) page_dirty_top[page] = dirty_top;
+        if (dirty_bottom > page_dirty_bottom[page]) page_dirty_bottom[page] = dirty_bottom;
+    }
+
+    uint8_t* page_base = video_memory + target * MODEX_ROW_BYTES * display_height;
+    int16_t* x0 = page_dirty_x0[target];
+    int16_t* x1 = page_dirty_x1[target];
+    int top = page_dirty_top[target];
+    int bottom = page_dirty_bottom[target];
+
+    for (int plane = 0; plane < 4; plane++) {
+        set_map_mask(1 << plane);
+        for (int row = top; row < bottom; row++) {
+            if (x0[row] >= x1[row]) {
+                continue;
+            }
+            int start = x0[row] + ((plane - x0[row]) & 3);
+            const uint8_t* src = back_buffer + row * screen.pitch + start;
+            uint8_t* dest = page_base + row * MODEX_ROW_BYTES + (start >> 2);
+            for (int x = start; x < x1[row]; x += 4) {
+                *dest++ = *src;
+                src += 4;
+            }
+        }
+    }
+
+    for (int row = top; row < bottom; row++) {
+        x0[row] = SCREEN_WIDTH;
+        x1[row] = 0;
+    }
+    page_dirty_top[target] = MODEX_MAX_HEIGHT;
+    page_dirty_bottom[target] = 0;
+
+    flip_page(target);
+}
+
+
+void Graphics::present_lfb() {
+    uint8_t* framebuffer = lfb_surface.pixels;
+    uint32_t pitch = lfb_surface.pitch;
+    bool wide = lfb_surface.format == PIXEL_FORMAT_XRGB32;
+    int bytes_per_pixel = wide ? 4 : 1;
+
+    for (int row = dirty_top; row < dirty_bottom; row++) {
+        int x0 = dirty_x0[row];
+        int x1 = dirty_x1[row];
+        if (x0 >= x1) {
+            continue;
+        }
+
+        const uint8_t* src = back_buffer + row * screen.pitch + x0;
+        uint32_t span_bytes = (x1 - x0) * lfb_scale * bytes_per_pixel;
+        uint8_t* dest = framebuffer + (lfb_y + row * lfb_scale) * pitch +
+                        (lfb_x + x0 * lfb_scale) * bytes_per_pixel;
+
+        
+        if (wide) {
+            uint32_t* line = lfb_line;
+            for (int x = x0; x < x1; x++) {
+                uint32_t rgb = palette_rgb[*src++];
+                for (int k = 0; k < lfb_scale; k++) {
+                    *line++ = rgb;
+                }
+            }
+        } else {
+            uint8_t* line = (uint8_t*)lfb_line;
+            for (int x = x0; x < x1; x++) {
+                uint8_t index = *src++;
+                for (int k = 0; k < lfb_scale; k++) {
+                    *line++ = index;
+                }
+            }
+        }
+
+        for (int k = 0; k < lfb_scale; k++) {
+            copy_span(dest, (const uint8_t*)lfb_line, span_bytes);
+            dest += pitch;
+        }
+    }
+}
+
+
+void Graphics::flip_page(int page) {
+    uint16_t start = page * MODEX_ROW_BYTES * display_height;
+
+    
+    while (inb(0x3DA) & 0x01);
+    outb(0x3D4, 0x0C);
+    outb(0x3D5, start >> 8);
+    outb(0x3D4, 0x0D);
+    outb(0x3D5, start & 0xFF);
+    visible_page = page;
+
+    
+    if (present_mode == PRESENT_VSYNC || page_count < 3) {
+        while (!(inb(0x3DA) & 0x08));
+    } else {
+        pending_page = page;
     }
 }
 
 void Graphics::set_palette(uint8_t index, uint8_t r, uint8_t g, uint8_t b) {
-    outb(0x3C8, index);
-    outb(0x3C9, r >> 2);  
-    outb(0x3C9, g >> 2);
-    outb(0x3C9, b >> 2);
-}
-
-
-static const uint8_t* get_font_char(char c) {
-    static const uint8_t font_space[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    static const uint8_t font_A[] = {0x00, 0x18, 0x24, 0x42, 0x7E, 0x42, 0x42, 0x00};
-    static const uint8_t font_B[] = {0x00, 0x7C, 0x42, 0x7C, 0x42, 0x42, 0x7C, 0x00};
-    static const uint8_t font_C[] = {0x00, 0x3C, 0x42, 0x40, 0x40, 0x42, 0x3C, 0x00};
-    static const uint8_t font_D[] = {0x00, 0x78, 0x44, 0x42, 0x42, 0x44, 0x78, 0x00};
-    static const uint8_t font_E[] = {0x00, 0x7E, 0x40, 0x7C, 0x40, 0x40, 0x7E, 0x00};
-    static const uint8_t font_F[] = {0x00, 0x7E, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x00};
-    static const uint8_t font_G[] = {0x00, 0x3C, 0x42, 0x40, 0x4E, 0x42, 0x3C, 0x00};
-    static const uint8_t font_H[] = {0x00, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x00};
-    static const uint8_t font_I[] = {0x00, 0x3E, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x00};
-    static const uint8_t font_K[] = {0x00, 0x44, 0x48, 0x70, 0x48, 0x44, 0x42, 0x00};
-    static const uint8_t font_L[] = {0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7E, 0x00};
-    static const uint8_t font_M[] = {0x00, 0x42, 0x66, 0x5A, 0x42, 0x42, 0x42, 0x00};
-    static const uint8_t font_N[] = {0x00, 0x42, 0x62, 0x52, 0x4A, 0x46, 0x42, 0x00};
-    static const uint8_t font_O[] = {0x00, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00};
-    static const uint8_t font_P[] = {0x00, 0x7C, 0x42, 0x42, 0x7C, 0x40, 0x40, 0x00};
-    static const uint8_t font_Q[] = {0x00, 0x3C, 0x42, 0x42, 0x52, 0x4A, 0x3C, 0x00};
-    static const uint8_t font_R[] = {0x00, 0x7C, 0x42, 0x42, 0x7C, 0x44, 0x42, 0x00};
-    static const uint8_t font_S[] = {0x00, 0x3C, 0x40, 0x3C, 0x02, 0x42, 0x3C, 0x00};
-    static const uint8_t font_T[] = {0x00, 0xFE, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00};
-    static const uint8_t font_U[] = {0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00};
-    static const uint8_t font_V[] = {0x00, 0x42, 0x42, 0x42, 0x42, 0x24, 0x18, 0x00};
-    static const uint8_t font_W[] = {0x00, 0x42, 0x42, 0x42, 0x5A, 0x66, 0x42, 0x00};
-    static const uint8_t font_X[] = {0x00, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x00};
-    static const uint8_t font_Y[] = {0x00, 0x82, 0x44, 0x28, 0x10, 0x10, 0x10, 0x00};
-    static const uint8_t font_Z[] = {0x00, 0x7E, 0x04, 0x08, 0x10, 0x20, 0x7E, 0x00};
-    static const uint8_t font_J[] = {0x00, 0x02, 0x02, 0x02, 0x42, 0x42, 0x3C, 0x00};
-    static const uint8_t font_0[] = {0x00, 0x3C, 0x46, 0x4A, 0x52, 0x62, 0x3C, 0x00};
-    static const uint8_t font_1[] = {0x00, 0x18, 0x28, 0x08, 0x08, 0x08, 0x3E, 0x00};
-    static const uint8_t font_2[] = {0x00, 0x3C, 0x42, 0x02, 0x3C, 0x40, 0x7E, 0x00};
-    static const uint8_t font_3[] = {0x00, 0x3C, 0x42, 0x0C, 0x02, 0x42, 0x3C, 0x00};
-    static const uint8_t font_4[] = {0x00, 0x08, 0x18, 0x28, 0x48, 0x7E, 0x08, 0x00};
-    static const uint8_t font_5[] = {0x00, 0x7E, 0x40, 0x7C, 0x02, 0x42, 0x3C, 0x00};
-    static const uint8_t font_6[] = {0x00, 0x3C, 0x40, 0x7C, 0x42, 0x42, 0x3C, 0x00};
-    static const uint8_t font_7[] = {0x00, 0x7E, 0x02, 0x04, 0x08, 0x10, 0x10, 0x00};
-    static const uint8_t font_8[] = {0x00, 0x3C, 0x42, 0x3C, 0x42, 0x42, 0x3C, 0x00};
-    static const uint8_t font_9[] = {0x00, 0x3C, 0x42, 0x42, 0x3E, 0x02, 0x3C, 0x00};
-    static const uint8_t font_minus[] = {0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00};
-    static const uint8_t font_dot[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00};
-    static const uint8_t font_colon[] = {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00};
-    static const uint8_t font_gt[] = {0x00, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08};
-    static const uint8_t font_lparen[] = {0x00, 0x0C, 0x10, 0x20, 0x20, 0x10, 0x0C, 0x00};
-    static const uint8_t font_rparen[] = {0x00, 0x30, 0x08, 0x04, 0x04, 0x08, 0x30, 0x00};
-    static const uint8_t font_lbracket[] = {0x00, 0x3E, 0x20, 0x20, 0x20, 0x20, 0x3E, 0x00};
-    static const uint8_t font_rbracket[] = {0x00, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x7C, 0x00};
-    static const uint8_t font_slash[] = {0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00};
-    static const uint8_t font_underscore[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00};
-    static const uint8_t font_hash[] = {0x00, 0x24, 0x7E, 0x24, 0x24, 0x7E, 0x24, 0x00};
-    static const uint8_t font_plus[] = {0x00, 0x00, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x00};
-    static const uint8_t font_lt[] = {0x00, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10};
-    static const uint8_t font_comma[]     = {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30};
-    
-    static const uint8_t font_excl[]      = {0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00};
-    static const uint8_t font_question[]  = {0x00, 0x3C, 0x42, 0x04, 0x08, 0x00, 0x08, 0x00};
-    static const uint8_t font_star[]      = {0x00, 0x00, 0x24, 0x18, 0x7E, 0x18, 0x24, 0x00};
-    static const uint8_t font_equal[]     = {0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x00};
-    static const uint8_t font_lbrace[]    = {0x00, 0x0E, 0x08, 0x30, 0x08, 0x08, 0x0E, 0x00};
-    static const uint8_t font_rbrace[]    = {0x00, 0x70, 0x10, 0x0C, 0x10, 0x10, 0x70, 0x00};
-    static const uint8_t font_pipe[]      = {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00};
-    static const uint8_t font_backslash[] = {0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00};
-    static const uint8_t font_at[]        = {0x00, 0x3C, 0x42, 0x5A, 0x5E, 0x40, 0x3C, 0x00};
-    static const uint8_t font_dollar[]    = {0x00, 0x08, 0x3E, 0x28, 0x3E, 0x0A, 0x3E, 0x08};
-    static const uint8_t font_percent[]   = {0x00, 0x62, 0x64, 0x08, 0x10, 0x26, 0x46, 0x00};
-    static const uint8_t font_amp[]       = {0x00, 0x30, 0x48, 0x30, 0x4A, 0x44, 0x3A, 0x00};
-    static const uint8_t font_caret[]     = {0x00, 0x18, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00};
-    static const uint8_t font_tilde[]     = {0x00, 0x00, 0x00, 0x32, 0x4C, 0x00, 0x00, 0x00};
-    static const uint8_t font_backtick[]  = {0x00, 0x20, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00};
-    static const uint8_t font_squote[]    = {0x00, 0x18, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00};
-    static const uint8_t font_dquote[]    = {0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00};
-    static const uint8_t font_semi[]      = {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x30};
-
-    switch(c) {
-        case ' ': return font_space;
-        case 'A': case 'a': return font_A;
-        case 'B': case 'b': return font_B;
-        case 'C': case 'c': return font_C;
-        case 'D': case 'd': return font_D;
-        case 'E': case 'e': return font_E;
-        case 'F': case 'f': return font_F;
-        case 'G': case 'g': return font_G;
-        case 'H': case 'h': return font_H;
-        case 'I': case 'i': return font_I;
-        case 'K': case 'k': return font_K;
-        case 'L': case 'l': return font_L;
-        case 'M': case 'm': return font_M;
-        case 'N': case 'n': return font_N;
-        case 'O': case 'o': return font_O;
-        case 'P': case 'p': return font_P;
-        case 'Q': case 'q': return font_Q;
-        case 'R': case 'r': return font_R;
-        case 'S': case 's': return font_S;
-        case 'T': case 't': return font_T;
-        case 'U': case 'u': return font_U;
-        case 'V': case 'v': return font_V;
-        case 'W': case 'w': return font_W;
-        case 'X': case 'x': return font_X;
-        case 'Y': case 'y': return font_Y;
-        case 'Z': case 'z': return font_Z;
-        case 'J': case 'j': return font_J;
-        case '0': return font_0;
-        case '1': return font_1;
-        case '2': return font_2;
-        case '3': return font_3;
-        case '4': return font_4;
-        case '5': return font_5;
-        case '6': return font_6;
-        case '7': return font_7;
-        case '8': return font_8;
-        case '9': return font_9;
-        case '-': return font_minus;
-        case '.': return font_dot;
-        case ':': return font_colon;
-        case ';': return font_semi;
-        case '>': return font_gt;
-        case '<': return font_lt;
-        case '(': return font_lparen;
-        case ')': return font_rparen;
-        case '[': return font_lbracket;
-        case ']': return font_rbracket;
-        case '{': return font_lbrace;
-        case '}': return font_rbrace;
-        case '/': return font_slash;
-        case '\\': return font_backslash;
-        case '_': return font_underscore;
-        case '#': return font_hash;
-        case '+': return font_plus;
-        case ',': return font_comma;
-        case '!': return font_excl;
-        case '?': return font_question;
-        case '*': return font_star;
-        case '=': return font_equal;
-        case '|': return font_pipe;
-        case '@': return font_at;
-        case '$': return font_dollar;
-        case '%': return font_percent;
-        case '&': return font_amp;
-        case '^': return font_caret;
-        case '~': return font_tilde;
-        case '`': return font_backtick;
-        case '\'': return font_squote;
-        case '"': return font_dquote;
-        default: return font_space;
+    uint8_t* entry = palette_shadow + index * 3;
+    entry[0] = r;
+    entry[1] = g;
+    entry[2] = b;
+    palette_generation++;
+    load_palette(index, 1, entry);
+}
+
+
+void Graphics::set_palette_range(uint8_t first, int count, const uint8_t* rgb) {
+    if (count > 256 - first) {
+        count = 256 - first;
+    }
+
+    uint8_t* entry = palette_shadow + first * 3;
+    for (int i = 0; i < count * 3; i++) {
+        entry[i] = rgb[i];
+    }
+    palette_generation++;
+    load_palette(first, count, entry);
+}
+
+
+void Graphics::load_palette(uint8_t first, int count, const uint8_t* rgb) {
+    if (count > 256 - first) {
+        count = 256 - first;
+    }
+    if (count <= 0) {
+        return;
+    }
+
+    uint8_t dac[256 * 3];
+    for (int i = 0; i < count; i++) {
+        uint8_t r = rgb[i * 3];
+        uint8_t g = rgb[i * 3 + 1];
+        uint8_t b = rgb[i * 3 + 2];
+        dac[i * 3] = r >> 2;
+        dac[i * 3 + 1] = g >> 2;
+        dac[i * 3 + 2] = b >> 2;
+        palette_rgb[first + i] = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+
+    outb(0x3C8, first);
+    outsb(0x3C9, dac, count * 3);
+
+    
+    if (video_mode == VIDEO_MODE_LFB && lfb_surface.format == PIXEL_FORMAT_XRGB32) {
+        mark_dirty(0, 0, screen.width, screen.height);
+    }
+}
+
+
+
+void Graphics::build_inverse_palette() {
+    palette_is_gray = true;
+    for (int i = 0; i < 256 && palette_is_gray; i++) {
+        const uint8_t* entry = palette_shadow + i * 3;
+        palette_is_gray = entry[0] == entry[1] && entry[1] == entry[2];
+    }
+
+    
+    if (palette_is_gray) {
+        for (int level = 0; level < 256; level++) {
+            int best = 0;
+            int best_error = 256;
+            for (int i = 0; i < 256; i++) {
+                int error = palette_shadow[i * 3] - level;
+                error = error < 0 ? -error : error;
+                if (error < best_error) {
+                    best = i;
+                    best_error = error;
+                }
+            }
+            gray_index[level] = (uint8_t)best;
+        }
+    }
+
+    if (!rgb555_index) {
+        rgb555_index = pool_alloc(32768);
+        if (!rgb555_index) {
+            inverse_generation = palette_is_gray ? palette_generation : 0;
+            return;
+        }
+    }
+
+    // Entries are searched on first use rather than all 32768 up front, so
+    // a palette change costs a 4 KB clear instead of a multi-second stall.
+    memset(rgb555_valid, 0, sizeof(rgb555_valid));
+    inverse_generation = palette_generation;
+}
+
+
+uint8_t Graphics::fill_rgb555(int key) {
+    int r = ((key >> 10) & 31) * 255 / 31;
+    int g = ((key >> 5) & 31) * 255 / 31;
+    int b = (key & 31) * 255 / 31;
+
+    int best = 0;
+    if (palette_is_gray) {
+        best = gray_index[(r * 77 + g * 150 + b * 29) >> 8];
+    } else {
+        int best_error = 0x7FFFFFFF;
+        for (int i = 0; i < 256; i++) {
+            const uint8_t* entry = palette_shadow + i * 3;
+            int dr = entry[0] - r;
+            int dg = entry[1] - g;
+            int db = entry[2] - b;
+            int error = dr * dr * 3 + dg * dg * 4 + db * db * 2;
+            if (error < best_error) {
+                best = i;
+                best_error = error;
+            }
+        }
+    }
+
+    rgb555_index[key] = (uint8_t)best;
+    rgb555_valid[key >> 5] |= 1u << (key & 31);
+    return (uint8_t)best;
+}
+
+
+bool Graphics::prepare_inverse_palette() {
+    if (inverse_generation != palette_generation) {
+        build_inverse_palette();
+    }
+    return inverse_generation == palette_generation && (palette_is_gray || rgb555_index);
+}
+
+
+uint8_t Graphics::nearest_rgb555(uint16_t key) {
+    key &= 0x7FFF;
+    if (rgb555_valid[key >> 5] & (1u << (key & 31))) {
+        return rgb555_index[key];
+    }
+    return fill_rgb555(key);
+}
+
+
+uint8_t Graphics::nearest_color(uint8_t r, uint8_t g, uint8_t b) {
+    if (!prepare_inverse_palette()) {
+        return 0;
+    }
+
+    if (palette_is_gray) {
+        return gray_index[(r * 77 + g * 150 + b * 29) >> 8];
+    }
+    return nearest_rgb555(((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3));
+}
+
+
+const uint8_t* Graphics::get_blend_table(BlendLevel level) {
+    if (level < 0 || level >= BLEND_LEVEL_COUNT) {
+        return nullptr;
+    }
+    if (!blend_tables[level]) {
+        blend_tables[level] = pool_alloc(256 * 256);
+        if (!blend_tables[level]) {
+            return nullptr;
+        }
+    }
+    if (blend_generation[level] == palette_generation) {
+        return blend_tables[level];
+    }
+
+    
+    int alpha = (level + 1) * 64;
+    uint8_t* table = blend_tables[level];
+    for (int src = 0; src < 256; src++) {
+        const uint8_t* s = palette_shadow + src * 3;
+        for (int dst = 0; dst < 256; dst++) {
+            const uint8_t* d = palette_shadow + dst * 3;
+            uint8_t r = (uint8_t)((s[0] * alpha + d[0] * (256 - alpha)) >> 8);
+            uint8_t g = (uint8_t)((s[1] * alpha + d[1] * (256 - alpha)) >> 8);
+            uint8_t b = (uint8_t)((s[2] * alpha + d[2] * (256 - alpha)) >> 8);
+            table[(src << 8) | dst] = nearest_color(r, g, b);
+        }
+    }
+    blend_generation[level] = palette_generation;
+    return table;
+}
+
+
+void Graphics::blend_rect(int x, int y, int width, int height, uint8_t color, BlendLevel level) {
+    const uint8_t* table = get_blend_table(level);
+    if (!table) {
+        return;
+    }
+
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    x -= target->origin_x;
+    y -= target->origin_y;
+    int x0 = x < clip.x ? clip.x : x;
+    int y0 = y < clip.y ? clip.y : y;
+    int x1 = x + width > clip.x + clip.width ? clip.x + clip.width : x + width;
+    int y1 = y + height > clip.y + clip.height ? clip.y + clip.height : y + height;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    const uint8_t* row = table + (color << 8);
+    uint8_t* dest = target->pixels + y0 * target->pitch + x0;
+    for (int py = y0; py < y1; py++) {
+        SpanKernels::table.remap(dest, x1 - x0, row);
+        dest += target->pitch;
+    }
+
+    touch(x0, y0, x1 - x0, y1 - y0);
+}
+
+
+struct GlyphDef {
+    char ch;
+    uint8_t rows[8];
+};
+
+static constexpr GlyphDef font_glyphs[] = {
+    {'A',  {0x00, 0x18, 0x24, 0x42, 0x7E, 0x42, 0x42, 0x00}},
+    {'B',  {0x00, 0x7C, 0x42, 0x7C, 0x42, 0x42, 0x7C, 0x00}},
+    {'C',  {0x00, 0x3C, 0x42, 0x40, 0x40, 0x42, 0x3C, 0x00}},
+    {'D',  {0x00, 0x78, 0x44, 0x42, 0x42, 0x44, 0x78, 0x00}},
+    {'E',  {0x00, 0x7E, 0x40, 0x7C, 0x40, 0x40, 0x7E, 0x00}},
+    {'F',  {0x00, 0x7E, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x00}},
+    {'G',  {0x00, 0x3C, 0x42, 0x40, 0x4E, 0x42, 0x3C, 0x00}},
+    {'H',  {0x00, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x00}},
+    {'I',  {0x00, 0x3E, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x00}},
+    {'K',  {0x00, 0x44, 0x48, 0x70, 0x48, 0x44, 0x42, 0x00}},
+    {'L',  {0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7E, 0x00}},
+    {'M',  {0x00, 0x42, 0x66, 0x5A, 0x42, 0x42, 0x42, 0x00}},
+    {'N',  {0x00, 0x42, 0x62, 0x52, 0x4A, 0x46, 0x42, 0x00}},
+    {'O',  {0x00, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00}},
+    {'P',  {0x00, 0x7C, 0x42, 0x42, 0x7C, 0x40, 0x40, 0x00}},
+    {'Q',  {0x00, 0x3C, 0x42, 0x42, 0x52, 0x4A, 0x3C, 0x00}},
+    {'R',  {0x00, 0x7C, 0x42, 0x42, 0x7C, 0x44, 0x42, 0x00}},
+    {'S',  {0x00, 0x3C, 0x40, 0x3C, 0x02, 0x42, 0x3C, 0x00}},
+    {'T',  {0x00, 0xFE, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00}},
+    {'U',  {0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00}},
+    {'V',  {0x00, 0x42, 0x42, 0x42, 0x42, 0x24, 0x18, 0x00}},
+    {'W',  {0x00, 0x42, 0x42, 0x42, 0x5A, 0x66, 0x42, 0x00}},
+    {'X',  {0x00, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x00}},
+    {'Y',  {0x00, 0x82, 0x44, 0x28, 0x10, 0x10, 0x10, 0x00}},
+    {'Z',  {0x00, 0x7E, 0x04, 0x08, 0x10, 0x20, 0x7E, 0x00}},
+    {'J',  {0x00, 0x02, 0x02, 0x02, 0x42, 0x42, 0x3C, 0x00}},
+    {'0',  {0x00, 0x3C, 0x46, 0x4A, 0x52, 0x62, 0x3C, 0x00}},
+    {'1',  {0x00, 0x18, 0x28, 0x08, 0x08, 0x08, 0x3E, 0x00}},
+    {'2',  {0x00, 0x3C, 0x42, 0x02, 0x3C, 0x40, 0x7E, 0x00}},
+    {'3',  {0x00, 0x3C, 0x42, 0x0C, 0x02, 0x42, 0x3C, 0x00}},
+    {'4',  {0x00, 0x08, 0x18, 0x28, 0x48, 0x7E, 0x08, 0x00}},
+    {'5',  {0x00, 0x7E, 0x40, 0x7C, 0x02, 0x42, 0x3C, 0x00}},
+    {'6',  {0x00, 0x3C, 0x40, 0x7C, 0x42, 0x42, 0x3C, 0x00}},
+    {'7',  {0x00, 0x7E, 0x02, 0x04, 0x08, 0x10, 0x10, 0x00}},
+    {'8',  {0x00, 0x3C, 0x42, 0x3C, 0x42, 0x42, 0x3C, 0x00}},
+    {'9',  {0x00, 0x3C, 0x42, 0x42, 0x3E, 0x02, 0x3C, 0x00}},
+    {'-',  {0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00}},
+    {'.',  {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00}},
+    {':',  {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00}},
+    {';',  {0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x30}},
+    {'>',  {0x00, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08}},
+    {'<',  {0x00, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10}},
+    {'(',  {0x00, 0x0C, 0x10, 0x20, 0x20, 0x10, 0x0C, 0x00}},
+    {')',  {0x00, 0x30, 0x08, 0x04, 0x04, 0x08, 0x30, 0x00}},
+    {'[',  {0x00, 0x3E, 0x20, 0x20, 0x20, 0x20, 0x3E, 0x00}},
+    {']',  {0x00, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x7C, 0x00}},
+    {'{',  {0x00, 0x0E, 0x08, 0x30, 0x08, 0x08, 0x0E, 0x00}},
+    {'}',  {0x00, 0x70, 0x10, 0x0C, 0x10, 0x10, 0x70, 0x00}},
+    {'/',  {0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00}},
+    {'\\', {0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00}},
+    {'_',  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00}},
+    {'#',  {0x00, 0x24, 0x7E, 0x24, 0x24, 0x7E, 0x24, 0x00}},
+    {'+',  {0x00, 0x00, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x00}},
+    {',',  {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30}},
+    {'!',  {0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00}},
+    {'?',  {0x00, 0x3C, 0x42, 0x04, 0x08, 0x00, 0x08, 0x00}},
+    {'*',  {0x00, 0x00, 0x24, 0x18, 0x7E, 0x18, 0x24, 0x00}},
+    {'=',  {0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x00}},
+    {'|',  {0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00}},
+    {'@',  {0x00, 0x3C, 0x42, 0x5A, 0x5E, 0x40, 0x3C, 0x00}},
+    {'$',  {0x00, 0x08, 0x3E, 0x28, 0x3E, 0x0A, 0x3E, 0x08}},
+    {'%',  {0x00, 0x62, 0x64, 0x08, 0x10, 0x26, 0x46, 0x00}},
+    {'&',  {0x00, 0x30, 0x48, 0x30, 0x4A, 0x44, 0x3A, 0x00}},
+    {'^',  {0x00, 0x18, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00}},
+    {'~',  {0x00, 0x00, 0x00, 0x32, 0x4C, 0x00, 0x00, 0x00}},
+    {'`',  {0x00, 0x20, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00}},
+    {'\'', {0x00, 0x18, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00}},
+    {'"',  {0x00, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00}},
+};
+
+struct FontAtlas {
+    uint8_t rows[256][8];
+};
+
+
+static constexpr FontAtlas build_font_atlas() {
+    FontAtlas atlas = {};
+    for (const GlyphDef& def : font_glyphs) {
+        for (int row = 0; row < 8; row++) {
+            atlas.rows[(uint8_t)def.ch][row] = def.rows[row];
+        }
+    }
+
+    for (int c = 'a'; c <= 'z'; c++) {
+        for (int row = 0; row < 8; row++) {
+            atlas.rows[c][row] = atlas.rows[c - 'a' + 'A'][row];
+        }
+    }
+    return atlas;
+}
+
+struct RowExpansion {
+    uint32_t nibble_mask[16];
+    uint8_t small_nibble[256];
+};
+
+
+static constexpr RowExpansion build_row_expansion() {
+    RowExpansion table = {};
+    for (int n = 0; n < 16; n++) {
+        uint32_t mask = 0;
+        for (int bit = 0; bit < 4; bit++) {
+            if (n & (0x8 >> bit)) {
+                mask |= 0xFFu << (bit * 8);
+            }
+        }
+        table.nibble_mask[n] = mask;
+    }
+
+    for (int line = 0; line < 256; line++) {
+        table.small_nibble[line] = (uint8_t)(((line >> 4) & 0x8) | ((line >> 3) & 0x4) |
+                                             ((line >> 2) & 0x2) | ((line >> 1) & 0x1));
+    }
+    return table;
+}
+
+static constexpr FontAtlas font_atlas = build_font_atlas();
+static constexpr RowExpansion row_expansion = build_row_expansion();
+
+typedef uint32_t unaligned_uint32_t __attribute__((aligned(1), may_alias));
+
+
+static inline void store_masked(uint8_t* dest, uint32_t mask, uint32_t pattern) {
+    if (mask) {
+        unaligned_uint32_t* word = (unaligned_uint32_t*)dest;
+        *word = (*word & ~mask) | (pattern & mask);
     }
 }
 
+static inline const uint8_t* get_font_char(char c) {
+    return font_atlas.rows[(uint8_t)c];
+}
+
+const uint8_t* Graphics::get_glyph(char c) {
+    return get_font_char(c);
+}
+
+
 void Graphics::draw_char(int x, int y, char c, uint8_t color) {
     const uint8_t* glyph = get_font_char(c);
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    int lx = x - target->origin_x;
+    int ly = y - target->origin_y;
 
-    for (int row = 0; row < 8; row++) {
-        uint8_t line = glyph[row];
-        for (int col = 0; col < 8; col++) {
-            if (line & (0x80 >> col)) {
-                put_pixel(x + col, y + row, color);
+    if (lx < clip.x || lx + 8 > clip.x + clip.width || ly < clip.y || ly + 8 > clip.y + clip.height) {
+        for (int row = 0; row < 8; row++) {
+            uint8_t line = glyph[row];
+            for (int col = 0; col < 8; col++) {
+                if (line & (0x80 >> col)) {
+                    put_pixel(x + col, y + row, color);
+                }
             }
         }
+        return;
+    }
+
+    uint32_t pattern = color * 0x01010101u;
+    uint8_t* dest = target->pixels + ly * target->pitch + lx;
+    for (int row = 0; row < 8; row++) {
+        uint8_t line = glyph[row];
+        store_masked(dest, row_expansion.nibble_mask[line >> 4], pattern);
+        store_masked(dest + 4, row_expansion.nibble_mask[line & 0x0F], pattern);
+        dest += target->pitch;
     }
+    touch(lx, ly, 8, 8);
 }
 
 
 void Graphics::draw_char_small(int x, int y, char c, uint8_t color) {
     const uint8_t* glyph = get_font_char(c);
+    const ClipRect& clip = target->clip_stack[target->clip_depth - 1];
+    int lx = x - target->origin_x;
+    int ly = y - target->origin_y;
 
-    
+    if (lx < clip.x || lx + 4 > clip.x + clip.width || ly < clip.y || ly + 6 > clip.y + clip.height) {
+        for (int row = 0; row < 6; row++) {
+            uint8_t line = glyph[row + 1];
+            for (int col = 0; col < 4; col++) {
+                if (line & (0x80 >> (col * 2))) {
+                    put_pixel(x + col, y + row, color);
+                }
+            }
+        }
+        return;
+    }
+
+    uint32_t pattern = color * 0x01010101u;
+    uint8_t* dest = target->pixels + ly * target->pitch + lx;
     for (int row = 0; row < 6; row++) {
-        uint8_t line = glyph[row + 1]; 
-        for (int col = 0; col < 4; col++) {
-            
-            if (line & (0x80 >> (col * 2))) {
-                put_pixel(x + col, y + row, color);
+        uint8_t nibble = row_expansion.small_nibble[glyph[row + 1]];
+        store_masked(dest, row_expansion.nibble_mask[nibble], pattern);
+        dest += target->pitch;
+    }
+    touch(lx, ly, 4, 6);
+}
+
+void Graphics::draw_run(int x, int y, const char* text, int length, uint8_t color,
+                        const ClipRect* clip, bool small) {
+    const int advance = small ? FONT_SMALL_WIDTH : FONT_WIDTH;
+    const int rows = small ? FONT_SMALL_HEIGHT : FONT_HEIGHT;
+    const int glyph_row = small ? 1 : 0;
+
+    const ClipRect& top = target->clip_stack[target->clip_depth - 1];
+    x -= target->origin_x;
+    y -= target->origin_y;
+    int cx0 = top.x;
+    int cy0 = top.y;
+    int cx1 = top.x + top.width;
+    int cy1 = top.y + top.height;
+    if (clip) {
+        int clip_x = clip->x - target->origin_x;
+        int clip_y = clip->y - target->origin_y;
+        if (clip_x > cx0) cx0 = clip_x;
+        if (clip_y > cy0) cy0 = clip_y;
+        if (clip_x + clip->width < cx1) cx1 = clip_x + clip->width;
+        if (clip_y + clip->height < cy1) cy1 = clip_y + clip->height;
+    }
+
+    if (length <= 0 || y >= cy1 || y + rows <= cy0 || x >= cx1 || x + length * advance <= cx0) {
+        return;
+    }
+
+    int row_begin = y < cy0 ? cy0 - y : 0;
+    int row_end = y + rows > cy1 ? cy1 - y : rows;
+    int first = x < cx0 ? (cx0 - x) / advance : 0;
+    int last = (cx1 - x + advance - 1) / advance;
+    if (last > length) last = length;
+
+    uint32_t pattern = color * 0x01010101u;
+    const int pitch = target->pitch;
+    uint8_t* origin = target->pixels + (y + row_begin) * pitch;
+
+    for (int i = first; i < last; i++) {
+        int gx = x + i * advance;
+        const uint8_t* glyph = get_font_char(text[i]) + glyph_row;
+
+        if (gx >= cx0 && gx + advance <= cx1) {
+            uint8_t* dest = origin + gx;
+            for (int row = row_begin; row < row_end; row++) {
+                uint8_t line = glyph[row];
+                if (small) {
+                    store_masked(dest, row_expansion.nibble_mask[row_expansion.small_nibble[line]], pattern);
+                } else {
+                    store_masked(dest, row_expansion.nibble_mask[line >> 4], pattern);
+                    store_masked(dest + 4, row_expansion.nibble_mask[line & 0x0F], pattern);
+                }
+                dest += pitch;
+            }
+        } else {
+            int col_begin = gx < cx0 ? cx0 - gx : 0;
+            int col_end = gx + advance > cx1 ? cx1 - gx : advance;
+            int step = small ? 2 : 1;
+            uint8_t* dest = origin + gx + col_begin;
+            for (int row = row_begin; row < row_end; row++) {
+                uint8_t line = glyph[row];
+                for (int col = col_begin; col < col_end; col++) {
+                    if (line & (0x80 >> (col * step))) {
+                        dest[col - col_begin] = color;
+                    }
+                }
+                dest += pitch;
             }
         }
     }
+
+    int dirty_x = x + first * advance;
+    if (dirty_x < cx0) dirty_x = cx0;
+    int dirty_end = x + last * advance;
+    if (dirty_end > cx1) dirty_end = cx1;
+    touch(dirty_x, y + row_begin, dirty_end - dirty_x, row_end - row_begin);
 }
 
-void Graphics::draw_text(int x, int y, const char* text, uint8_t color) {
-    int cursor_x = x;
+void Graphics::draw_text_run(int x, int y, const char* text, int length, uint8_t color, const ClipRect* clip) {
+    draw_run(x, y, text, length, color, clip, false);
+}
+
+void Graphics::draw_text_run_small(int x, int y, const char* text, int length, uint8_t color, const ClipRect* clip) {
+    draw_run(x, y, text, length, color, clip, true);
+}
+
+void Graphics::draw_text_clipped(int x, int y, const char* text, uint8_t color, const ClipRect* clip) {
     while (*text) {
+        int length = 0;
+        while (text[length] && text[length] != '\n') {
+            length++;
+        }
+        draw_run(x, y, text, length, color, clip, false);
+
+        text += length;
         if (*text == '\n') {
-            cursor_x = x;
-            y += 8;
-        } else {
-            draw_char(cursor_x, y, *text, color);
-            cursor_x += 8;
+            text++;
+            y += FONT_HEIGHT;
         }
-        text++;
     }
 }
 
+void Graphics::draw_text(int x, int y, const char* text, uint8_t color) {
+    draw_text_clipped(x, y, text, color, nullptr);
+}
+
 
 void Graphics::draw_text_small(int x, int y, const char* text, uint8_t color) {
-    int cursor_x = x;
     while (*text) {
+        int length = 0;
+        while (text[length] && text[length] != '\n') {
+            length++;
+        }
+        draw_run(x, y, text, length, color, nullptr, true);
+
+        text += length;
         if (*text == '\n') {
-            cursor_x = x;
-            y += 6;
+            text++;
+            y += FONT_SMALL_HEIGHT;
+        }
+    }
+}
+
+
+void Graphics::measure(const char* text, int advance, int line_height, int* width, int* height) {
+    int widest = 0;
+    int lines = 1;
+    int current = 0;
+    for (; *text; text++) {
+        if (*text == '\n') {
+            lines++;
+            current = 0;
         } else {
-            draw_char_small(cursor_x, y, *text, color);
-            cursor_x += 4;
+            current += advance;
+            if (current > widest) widest = current;
         }
-        text++;
     }
+
+    if (width) *width = widest;
+    if (height) *height = lines * line_height;
+}
+
+void Graphics::measure_text(const char* text, int* width, int* height) {
+    measure(text, FONT_WIDTH, FONT_HEIGHT, width, height);
+}
+
+void Graphics::measure_text_small(const char* text, int* width, int* height) {
+    measure(text, FONT_SMALL_WIDTH, FONT_SMALL_HEIGHT, width, height);
 }
 
 void Graphics::draw_image(int x, int y, int width, int height, const uint8_t* data) {
@@ -362,11 +1690,27 @@ void Graphics::draw_image(int x, int y, int width, int height, const uint8_t* da
         return;
     }
 
-    int index = 0;
+    Surface image;
+    wrap_surface(&image, (uint8_t*)data, width, height);
+    blit(&image, nullptr, x, y, BLIT_OPAQUE);
+}
+
+
+void Graphics::draw_icon(int x, int y, const uint8_t* rows, int height, uint8_t color) {
+    if (height > ICON_SIZE) {
+        height = ICON_SIZE;
+    }
+
+    
+    uint8_t pixels[ICON_SIZE * ICON_SIZE];
+    uint8_t key = color + 1;
     for (int row = 0; row < height; row++) {
-        for (int col = 0; col < width; col++) {
-            uint8_t pixel = data[index++];
-            put_pixel(x + col, y + row, pixel);
+        for (int col = 0; col < ICON_SIZE; col++) {
+            pixels[row * ICON_SIZE + col] = (rows[row] & (0x80 >> col)) ? color : key;
         }
     }
+
+    Surface icon;
+    wrap_surface(&icon, pixels, ICON_SIZE, height);
+    blit(&icon, nullptr, x, y, key);
 }
@@ -0,0 +1,146 @@
+#include "image_scaler.h"
+
+
+ScaledImage ImageScaler::cache[SCALE_CACHE_SLOTS];
+uint32_t ImageScaler::use_clock = 0;
+
+static int16_t column_index[SCREEN_WIDTH];
+static uint8_t column_frac[SCREEN_WIDTH];
+static int16_t row_index[SCREEN_HEIGHT];
+static uint8_t row_frac[SCREEN_HEIGHT];
+
+void ImageScaler::build_tables(int source_size, int size, bool bilinear, int16_t* index, uint8_t* frac) {
+    for (int i = 0; i < size; i++) {
+        
+        int position = (2 * i + 1) * source_size * 128 / size - 128;
+        if (!bilinear) {
+            position += 128;
+        }
+        if (position < 0) {
+            position = 0;
+        }
+
+        int whole = position >> 8;
+        if (whole >= source_size - 1) {
+            index[i] = (int16_t)(source_size - 1);
+            frac[i] = 0;
+        } else {
+            index[i] = (int16_t)whole;
+            frac[i] = bilinear ? (uint8_t)(position & 0xFF) : 0;
+        }
+    }
+}
+
+
+void ImageScaler::render(const Surface* source, ScaledImage* image) {
+    bool bilinear = image->filter == SCALE_BILINEAR;
+    build_tables(source->width, image->width, bilinear, column_index, column_frac);
+    build_tables(source->height, image->height, bilinear, row_index, row_frac);
+
+    uint8_t* dest = image->surface.pixels;
+    if (!bilinear) {
+        for (int y = 0; y < image->height; y++) {
+            const uint8_t* src = source->pixels + row_index[y] * source->pitch;
+            for (int x = 0; x < image->width; x++) {
+                dest[x] = src[column_index[x]];
+            }
+            dest += image->surface.pitch;
+        }
+        return;
+    }
+
+    
+    const uint8_t* palette = Graphics::get_palette();
+    for (int y = 0; y < image->height; y++) {
+        const uint8_t* top = source->pixels + row_index[y] * source->pitch;
+        const uint8_t* bottom = row_frac[y] ? top + source->pitch : top;
+        int fy = row_frac[y];
+        for (int x = 0; x < image->width; x++) {
+            int sx = column_index[x];
+            int fx = column_frac[x];
+            int sx1 = fx ? sx + 1 : sx;
+            const uint8_t* p00 = palette + top[sx] * 3;
+            const uint8_t* p01 = palette + top[sx1] * 3;
+            const uint8_t* p10 = palette + bottom[sx] * 3;
+            const uint8_t* p11 = palette + bottom[sx1] * 3;
+
+            uint8_t rgb[3];
+            for (int c = 0; c < 3; c++) {
+                int upper = p00[c] * (256 - fx) + p01[c] * fx;
+                int lower = p10[c] * (256 - fx) + p11[c] * fx;
+                rgb[c] = (uint8_t)((upper * (256 - fy) + lower * fy) >> 16);
+            }
+            dest[x] = Graphics::nearest_color(rgb[0], rgb[1], rgb[2]);
+        }
+        dest += image->surface.pitch;
+    }
+}
+
+
+const Surface* ImageScaler::scale(const Surface* source, int width, int height, ScaleFilter filter) {
+    if (!source || source->width <= 0 || source->height <= 0 ||
+        width <= 0 || height <= 0 || width > SCREEN_WIDTH || height > SCREEN_HEIGHT) {
+        return nullptr;
+    }
+
+    uint32_t generation = filter == SCALE_BILINEAR ? Graphics::get_palette_generation() : 0;
+    use_clock++;
+
+    ScaledImage* victim = &cache[0];
+    for (int i = 0; i < SCALE_CACHE_SLOTS; i++) {
+        ScaledImage* image = &cache[i];
+        if (image->valid && image->source_pixels == source->pixels && image->source_pitch == source->pitch &&
+            image->source_width == source->width && image->source_height == source->height &&
+            image->width == width && image->height == height && image->filter == filter &&
+            image->generation == generation) {
+            image->last_used = use_clock;
+            return &image->surface;
+        }
+        if (image->last_used < victim->last_used) {
+            victim = image;
+        }
+    }
+
+    
+    // The pool never frees, so each slot is sized once for the largest image
+    // it can hold instead of growing with every bigger request.
+    if (!victim->surface.pixels) {
+        victim->surface.pixels = Graphics::pool_alloc(SCREEN_WIDTH * SCREEN_HEIGHT);
+        if (!victim->surface.pixels) {
+            return nullptr;
+        }
+    }
+    int pitch = (width + 3) & ~3;
+    Graphics::wrap_surface(&victim->surface, victim->surface.pixels, width, height);
+    victim->surface.pitch = pitch;
+
+    victim->source_pixels = source->pixels;
+    victim->source_pitch = source->pitch;
+    victim->source_width = source->width;
+    victim->source_height = source->height;
+    victim->width = width;
+    victim->height = height;
+    victim->filter = filter;
+    victim->generation = generation;
+    victim->last_used = use_clock;
+    victim->valid = true;
+    render(source, victim);
+    return &victim->surface;
+}
+
+void ImageScaler::draw(const Surface* source, int x, int y, int width, int height, ScaleFilter filter) {
+    const Surface* scaled = scale(source, width, height, filter);
+    if (scaled) {
+        Graphics::blit(scaled, nullptr, x, y, BLIT_OPAQUE);
+    }
+}
+
+
+void ImageScaler::invalidate(const uint8_t* source_pixels) {
+    for (int i = 0; i < SCALE_CACHE_SLOTS; i++) {
+        if (cache[i].source_pixels == source_pixels) {
+            cache[i].valid = false;
+            cache[i].last_used = 0;
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#include "palette_animator.h"
+#include "graphics.h"
+
+
+int32_t PaletteAnimator::level = PALETTE_LEVEL_FULL << 8;
+int32_t PaletteAnimator::fade_delta = 0;
+int32_t PaletteAnimator::fade_target = PALETTE_LEVEL_FULL << 8;
+uint16_t PaletteAnimator::fade_frames = 0;
+PaletteCycle PaletteAnimator::cycles[PALETTE_MAX_CYCLES];
+int PaletteAnimator::cycle_count = 0;
+bool PaletteAnimator::dirty = false;
+
+void PaletteAnimator::set_level(uint8_t new_level) {
+    level = new_level << 8;
+    fade_target = level;
+    fade_frames = 0;
+    dirty = true;
+}
+
+
+void PaletteAnimator::fade_to(uint8_t new_level, uint16_t frames) {
+    if (frames == 0) {
+        set_level(new_level);
+        return;
+    }
+
+    fade_target = new_level << 8;
+    fade_delta = (fade_target - level) / frames;
+    fade_frames = frames;
+}
+
+bool PaletteAnimator::add_cycle(uint8_t first, uint8_t count, uint8_t frames_per_step) {
+    if (cycle_count == PALETTE_MAX_CYCLES || count < 2 || first + count > 256) {
+        return false;
+    }
+    if (frames_per_step == 0) {
+        frames_per_step = 1;
+    }
+
+    PaletteCycle& cycle = cycles[cycle_count++];
+    cycle.first = first;
+    cycle.count = count;
+    cycle.frames_per_step = frames_per_step;
+    cycle.countdown = frames_per_step;
+    cycle.offset = 0;
+    return true;
+}
+
+void PaletteAnimator::clear_cycles() {
+    if (cycle_count) {
+        cycle_count = 0;
+        dirty = true;
+    }
+}
+
+
+void PaletteAnimator::step() {
+    bool changed = dirty;
+
+    if (fade_frames) {
+        fade_frames--;
+        level = fade_frames ? level + fade_delta : fade_target;
+        changed = true;
+    }
+
+    for (int i = 0; i < cycle_count; i++) {
+        PaletteCycle& cycle = cycles[i];
+        if (--cycle.countdown == 0) {
+            cycle.countdown = cycle.frames_per_step;
+            cycle.offset = cycle.offset + 1 == cycle.count ? 0 : cycle.offset + 1;
+            changed = true;
+        }
+    }
+
+    if (!changed) {
+        return;
+    }
+    dirty = false;
+
+    
+    const uint8_t* shadow = Graphics::get_palette();
+    uint8_t rgb[256 * 3];
+    for (int i = 0; i < 256 * 3; i++) {
+        rgb[i] = shadow[i];
+    }
+
+    for (int i = 0; i < cycle_count; i++) {
+        const PaletteCycle& cycle = cycles[i];
+        int source = cycle.offset;
+        for (int entry = 0; entry < cycle.count; entry++) {
+            const uint8_t* from = shadow + (cycle.first + source) * 3;
+            uint8_t* to = rgb + (cycle.first + entry) * 3;
+            to[0] = from[0];
+            to[1] = from[1];
+            to[2] = from[2];
+            if (++source == cycle.count) source = 0;
+        }
+    }
+
+    
+    int scale = level >> 8;
+    scale += scale >> 7;
+    if (scale != 256) {
+        for (int i = 0; i < 256 * 3; i++) {
+            rgb[i] = (rgb[i] * scale) >> 8;
+        }
+    }
+
+    Graphics::load_palette(0, 256, rgb);
+}
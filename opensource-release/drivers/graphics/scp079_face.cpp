@@ -1,613 +0,0 @@
-
-
-
-
-#include "types.h"
-
-
-int SCP079_FACE_WIDTH = 98;
-int SCP079_FACE_HEIGHT = 98;
-
-uint8_t scp079_face_data[] = {
-    0x0B, 0x06, 0x0A, 0x0B, 0x0B, 0x0C, 0x0B, 0x0E, 0x09, 0x0A, 0x0B, 0x0B, 0x07, 0x09, 0x0D, 0x0C,
-    0x08, 0x04, 0x04, 0x06, 0x08, 0x05, 0x06, 0x06, 0x04, 0x09, 0x11, 0x14, 0x0D, 0x08, 0x07, 0x08,
-    0x09, 0x0A, 0x10, 0x0F, 0x10, 0x0B, 0x0D, 0x0B, 0x0A, 0x18, 0x1B, 0x17, 0x1F, 0x19, 0x0F, 0x14,
-    0x17, 0x18, 0x18, 0x1E, 0x11, 0x0D, 0x0B, 0x0D, 0x1D, 0x16, 0x13, 0x0E, 0x0D, 0x09, 0x0E, 0x14,
-    0x16, 0x0F, 0x0B, 0x06, 0x08, 0x0F, 0x0E, 0x15, 0x13, 0x0D, 0x0E, 0x11, 0x0F, 0x0A, 0x0E, 0x0E,
-    0x0C, 0x0E, 0x0B, 0x07, 0x06, 0x06, 0x06, 0x07, 0x04, 0x04, 0x05, 0x07, 0x08, 0x04, 0x04, 0x04,
-    0x05, 0x07, 0x08, 0x07, 0x09, 0x0A, 0x08, 0x06, 0x08, 0x0A, 0x05, 0x09, 0x07, 0x04, 0x08, 0x09,
-    0x0B, 0x0A, 0x0D, 0x07, 0x04, 0x06, 0x05, 0x05, 0x04, 0x0A, 0x0B, 0x09, 0x13, 0x15, 0x10, 0x09,
-    0x11, 0x0F, 0x08, 0x0B, 0x0A, 0x13, 0x0F, 0x08, 0x0A, 0x09, 0x09, 0x0C, 0x0C, 0x12, 0x15, 0x0F,
-    0x06, 0x0C, 0x0F, 0x0A, 0x19, 0x17, 0x09, 0x0D, 0x11, 0x12, 0x16, 0x0E, 0x10, 0x0E, 0x0B, 0x07,
-    0x10, 0x14, 0x1C, 0x14, 0x0F, 0x0D, 0x0A, 0x18, 0x23, 0x17, 0x0B, 0x0C, 0x0C, 0x0E, 0x0E, 0x0D,
-    0x0F, 0x0F, 0x0F, 0x0E, 0x06, 0x07, 0x06, 0x07, 0x03, 0x05, 0x05, 0x03, 0x04, 0x07, 0x08, 0x04,
-    0x04, 0x04, 0x08, 0x08, 0x11, 0x0B, 0x0B, 0x0D, 0x0E, 0x0C, 0x0A, 0x0D, 0x0B, 0x0C, 0x0C, 0x0C,
-    0x12, 0x0F, 0x0A, 0x0A, 0x0E, 0x11, 0x07, 0x05, 0x05, 0x07, 0x07, 0x1C, 0x1C, 0x16, 0x22, 0x1E,
-    0x24, 0x20, 0x12, 0x0E, 0x0D, 0x10, 0x14, 0x17, 0x11, 0x07, 0x06, 0x08, 0x16, 0x1A, 0x19, 0x14,
-    0x1C, 0x2E, 0x2A, 0x2F, 0x11, 0x0F, 0x1C, 0x1D, 0x15, 0x2B, 0x15, 0x14, 0x0E, 0x18, 0x28, 0x13,
-    0x0D, 0x13, 0x1C, 0x20, 0x1A, 0x17, 0x12, 0x17, 0x13, 0x16, 0x1C, 0x16, 0x15, 0x0D, 0x0B, 0x0D,
-    0x0B, 0x0C, 0x08, 0x15, 0x10, 0x0F, 0x0A, 0x04, 0x07, 0x10, 0x0B, 0x08, 0x09, 0x06, 0x0A, 0x0C,
-    0x08, 0x04, 0x05, 0x06, 0x0B, 0x09, 0x15, 0x0A, 0x0E, 0x10, 0x0B, 0x0C, 0x0D, 0x0C, 0x09, 0x0C,
-    0x13, 0x15, 0x0B, 0x0B, 0x09, 0x08, 0x09, 0x0F, 0x15, 0x13, 0x11, 0x12, 0x0B, 0x17, 0x2D, 0x22,
-    0x17, 0x34, 0x27, 0x1E, 0x15, 0x17, 0x15, 0x1F, 0x1E, 0x19, 0x2E, 0x23, 0x12, 0x0E, 0x26, 0x32,
-    0x3B, 0x33, 0x29, 0x30, 0x36, 0x1B, 0x1E, 0x29, 0x21, 0x23, 0x18, 0x22, 0x0F, 0x19, 0x24, 0x22,
-    0x2A, 0x12, 0x0C, 0x1E, 0x2C, 0x27, 0x1A, 0x18, 0x19, 0x0D, 0x15, 0x13, 0x15, 0x15, 0x24, 0x16,
-    0x0D, 0x0E, 0x14, 0x17, 0x12, 0x11, 0x0D, 0x0A, 0x0A, 0x09, 0x0D, 0x14, 0x13, 0x11, 0x0A, 0x07,
-    0x09, 0x0E, 0x0A, 0x05, 0x04, 0x07, 0x09, 0x07, 0x14, 0x10, 0x0E, 0x0A, 0x11, 0x16, 0x15, 0x0D,
-    0x08, 0x09, 0x0C, 0x0D, 0x0A, 0x0E, 0x08, 0x08, 0x13, 0x0F, 0x0D, 0x12, 0x18, 0x12, 0x15, 0x13,
-    0x21, 0x19, 0x32, 0x1F, 0x14, 0x2E, 0x24, 0x2F, 0x1C, 0x0E, 0x14, 0x14, 0x30, 0x38, 0x14, 0x15,
-    0x0E, 0x21, 0x2A, 0x2D, 0x37, 0x38, 0x28, 0x1A, 0x37, 0x36, 0x29, 0x2C, 0x1C, 0x0E, 0x17, 0x17,
-    0x1B, 0x1E, 0x21, 0x06, 0x10, 0x18, 0x24, 0x20, 0x1E, 0x27, 0x12, 0x10, 0x0B, 0x18, 0x11, 0x13,
-    0x1E, 0x20, 0x11, 0x14, 0x10, 0x0D, 0x0D, 0x14, 0x25, 0x13, 0x08, 0x0D, 0x05, 0x0C, 0x10, 0x10,
-    0x11, 0x0B, 0x0B, 0x0C, 0x0A, 0x06, 0x06, 0x06, 0x05, 0x06, 0x0C, 0x10, 0x14, 0x16, 0x0E, 0x13,
-    0x15, 0x0A, 0x0E, 0x0D, 0x0E, 0x06, 0x0F, 0x17, 0x11, 0x0D, 0x12, 0x12, 0x0A, 0x11, 0x1F, 0x19,
-    0x1F, 0x1D, 0x27, 0x41, 0x26, 0x17, 0x2C, 0x29, 0x0E, 0x2A, 0x3A, 0x4D, 0x3D, 0x23, 0x22, 0x2F,
-    0x15, 0x12, 0x0E, 0x1B, 0x09, 0x06, 0x16, 0x25, 0x23, 0x44, 0x37, 0x37, 0x41, 0x2E, 0x50, 0x4A,
-    0x44, 0x21, 0x21, 0x1E, 0x1C, 0x13, 0x1B, 0x30, 0x3F, 0x3E, 0x1F, 0x16, 0x13, 0x15, 0x19, 0x23,
-    0x13, 0x1D, 0x27, 0x12, 0x2D, 0x25, 0x19, 0x23, 0x17, 0x0C, 0x1F, 0x22, 0x09, 0x0C, 0x12, 0x07,
-    0x0A, 0x15, 0x10, 0x11, 0x0B, 0x0F, 0x09, 0x05, 0x08, 0x06, 0x06, 0x0B, 0x08, 0x07, 0x18, 0x16,
-    0x11, 0x14, 0x10, 0x0E, 0x0B, 0x0B, 0x0C, 0x13, 0x27, 0x2C, 0x1C, 0x15, 0x24, 0x19, 0x1B, 0x19,
-    0x38, 0x3C, 0x4A, 0x31, 0x21, 0x15, 0x23, 0x39, 0x29, 0x40, 0x4C, 0x2F, 0x53, 0x43, 0x47, 0x47,
-    0x4B, 0x58, 0x45, 0x4B, 0x3F, 0x1F, 0x24, 0x2B, 0x3B, 0x38, 0x5C, 0x4C, 0x34, 0x55, 0x52, 0x54,
-    0x3E, 0x84, 0x68, 0x37, 0x36, 0x36, 0x30, 0x46, 0x48, 0x75, 0x8A, 0x65, 0x50, 0x4A, 0x5A, 0x65,
-    0x35, 0x2C, 0x13, 0x1D, 0x2E, 0x4D, 0x20, 0x12, 0x11, 0x17, 0x14, 0x0C, 0x10, 0x1E, 0x1E, 0x1A,
-    0x0F, 0x1C, 0x18, 0x16, 0x11, 0x0D, 0x06, 0x0F, 0x11, 0x09, 0x08, 0x0F, 0x08, 0x06, 0x0C, 0x08,
-    0x13, 0x1E, 0x20, 0x19, 0x17, 0x20, 0x16, 0x1C, 0x1D, 0x36, 0x64, 0x85, 0x50, 0x48, 0x6A, 0x40,
-    0x66, 0x55, 0x9A, 0x87, 0x78, 0x8D, 0x3E, 0x50, 0xA8, 0xC4, 0xA8, 0xC7, 0xC0, 0xD7, 0xD6, 0xA5,
-    0xD5, 0xBA, 0xB6, 0xD0, 0xD7, 0xE8, 0xCA, 0x6A, 0x82, 0x7E, 0xAD, 0xBA, 0xE1, 0x8D, 0x4A, 0x95,
-    0x9A, 0x64, 0x85, 0xE7, 0x93, 0x66, 0x8D, 0x9D, 0x77, 0x8F, 0xC8, 0xDA, 0xDC, 0xD7, 0xB7, 0x83,
-    0x6E, 0xAF, 0x9B, 0x66, 0x68, 0x68, 0x56, 0x72, 0x66, 0x2A, 0x2B, 0x2C, 0x21, 0x2A, 0x21, 0x21,
-    0x28, 0x46, 0x31, 0x3A, 0x43, 0x42, 0x28, 0x16, 0x1B, 0x2E, 0x33, 0x1C, 0x20, 0x1A, 0x0E, 0x0B,
-    0x0A, 0x0C, 0x09, 0x07, 0x0D, 0x15, 0x0A, 0x09, 0x11, 0x12, 0x0E, 0x16, 0x2D, 0x37, 0x2D, 0x30,
-    0x20, 0x1D, 0x24, 0x1E, 0x42, 0x47, 0x24, 0x1F, 0x09, 0x24, 0x5B, 0x6E, 0x75, 0x42, 0x17, 0x4C,
-    0x5F, 0x4D, 0x4D, 0x40, 0x45, 0x52, 0x45, 0x2A, 0x31, 0x29, 0x18, 0x23, 0x2F, 0x35, 0x40, 0x3B,
-    0x11, 0x07, 0x1A, 0x1A, 0x54, 0x34, 0x1F, 0x26, 0x35, 0x24, 0x1D, 0x1D, 0x2D, 0x36, 0x32, 0x36,
-    0x20, 0x0F, 0x11, 0x13, 0x24, 0x2C, 0x2E, 0x52, 0x2A, 0x12, 0x1A, 0x19, 0x0F, 0x08, 0x06, 0x08,
-    0x10, 0x11, 0x0A, 0x0A, 0x19, 0x10, 0x0E, 0x19, 0x1B, 0x0B, 0x10, 0x18, 0x1A, 0x0D, 0x0E, 0x07,
-    0x04, 0x07, 0x0B, 0x0C, 0x09, 0x0C, 0x07, 0x17, 0x1A, 0x14, 0x10, 0x17, 0x20, 0x19, 0x17, 0x15,
-    0x20, 0x22, 0x1A, 0x10, 0x18, 0x1C, 0x39, 0x3E, 0x2B, 0x13, 0x15, 0x20, 0x3C, 0x6D, 0x4C, 0x48,
-    0x23, 0x22, 0x2F, 0x2B, 0x1A, 0x25, 0x31, 0x1D, 0x15, 0x15, 0x13, 0x14, 0x18, 0x24, 0x2E, 0x19,
-    0x23, 0x17, 0x17, 0x20, 0x19, 0x2B, 0x1E, 0x1B, 0x21, 0x23, 0x0E, 0x2A, 0x1C, 0x29, 0x17, 0x03,
-    0x1D, 0x1A, 0x1D, 0x2C, 0x1D, 0x14, 0x1A, 0x19, 0x11, 0x4C, 0x34, 0x18, 0x19, 0x1C, 0x0B, 0x08,
-    0x10, 0x15, 0x19, 0x26, 0x1C, 0x2D, 0x24, 0x17, 0x26, 0x1D, 0x20, 0x17, 0x1B, 0x19, 0x13, 0x0B,
-    0x06, 0x07, 0x05, 0x07, 0x09, 0x0B, 0x0C, 0x0A, 0x0C, 0x18, 0x21, 0x1A, 0x24, 0x31, 0x25, 0x1B,
-    0x12, 0x1D, 0x28, 0x35, 0x35, 0x3C, 0x3D, 0x3B, 0x5D, 0x54, 0x5E, 0x42, 0x24, 0x1B, 0x10, 0x49,
-    0x46, 0x2B, 0x1A, 0x31, 0x2F, 0x23, 0x28, 0x23, 0x0F, 0x12, 0x21, 0x2A, 0x0F, 0x24, 0x2E, 0x18,
-    0x17, 0x0D, 0x18, 0x16, 0x14, 0x15, 0x11, 0x15, 0x1C, 0x1C, 0x29, 0x26, 0x16, 0x3B, 0x2A, 0x3B,
-    0x67, 0x4E, 0x65, 0x5C, 0x66, 0x74, 0x41, 0x19, 0x2A, 0x25, 0x18, 0x3D, 0x46, 0x34, 0x45, 0x30,
-    0x22, 0x2D, 0x39, 0x32, 0x2E, 0x3B, 0x15, 0x46, 0x2A, 0x33, 0x45, 0x2F, 0x2E, 0x32, 0x32, 0x1F,
-    0x13, 0x0F, 0x0A, 0x09, 0x0B, 0x07, 0x09, 0x06, 0x05, 0x07, 0x0C, 0x11, 0x0F, 0x14, 0x14, 0x22,
-    0x0C, 0x0D, 0x12, 0x10, 0x0F, 0x2B, 0x29, 0x39, 0x3C, 0x44, 0x32, 0x1D, 0x37, 0x48, 0x1D, 0x1C,
-    0x1A, 0x11, 0x1E, 0x14, 0x0F, 0x0A, 0x0E, 0x0D, 0x0A, 0x08, 0x08, 0x0B, 0x19, 0x16, 0x0A, 0x1A,
-    0x23, 0x08, 0x0A, 0x0C, 0x0A, 0x07, 0x08, 0x09, 0x0B, 0x0E, 0x11, 0x13, 0x24, 0x51, 0x3C, 0x11,
-    0x1A, 0x32, 0x3F, 0x35, 0x43, 0x37, 0x39, 0x32, 0x2D, 0x3C, 0x21, 0x29, 0x27, 0x48, 0x61, 0x62,
-    0x76, 0x5C, 0x9E, 0xA2, 0xA0, 0x9B, 0xA1, 0x7D, 0x52, 0x53, 0x2A, 0x23, 0x32, 0x2A, 0x42, 0x30,
-    0x23, 0x0E, 0x10, 0x0A, 0x0B, 0x0C, 0x09, 0x07, 0x0C, 0x0C, 0x0B, 0x0E, 0x0E, 0x10, 0x11, 0x11,
-    0x2C, 0x34, 0x32, 0x1B, 0x15, 0x1C, 0x13, 0x21, 0x5B, 0x76, 0x88, 0x88, 0x74, 0x1D, 0x1B, 0x1F,
-    0x36, 0x3B, 0x22, 0x0D, 0x1C, 0x11, 0x0F, 0x11, 0x0E, 0x0C, 0x0B, 0x0A, 0x0A, 0x10, 0x17, 0x11,
-    0x12, 0x11, 0x11, 0x10, 0x0F, 0x0F, 0x0E, 0x0B, 0x0C, 0x0B, 0x15, 0x19, 0x1A, 0x31, 0x50, 0x43,
-    0x48, 0x58, 0x3C, 0x3A, 0x17, 0x3A, 0x73, 0x5D, 0x6F, 0x5A, 0x20, 0x3B, 0x2A, 0x25, 0x38, 0x58,
-    0x84, 0x78, 0x6C, 0x8B, 0xA2, 0xBA, 0xCE, 0xBF, 0xB0, 0xB6, 0xAF, 0x58, 0x23, 0x21, 0x22, 0x31,
-    0x4D, 0x2D, 0x37, 0x1D, 0x0B, 0x0C, 0x0D, 0x10, 0x0E, 0x11, 0x0A, 0x09, 0x11, 0x17, 0x11, 0x16,
-    0x0E, 0x2B, 0x37, 0x4A, 0x59, 0x22, 0x2C, 0x1D, 0x14, 0x15, 0x44, 0x86, 0x82, 0xAA, 0x79, 0x25,
-    0x2D, 0x25, 0x36, 0x4E, 0x2E, 0x19, 0x13, 0x0F, 0x0F, 0x0E, 0x0B, 0x08, 0x07, 0x08, 0x01, 0x2E,
-    0x43, 0x08, 0x13, 0x0D, 0x09, 0x0D, 0x0E, 0x0E, 0x14, 0x08, 0x07, 0x0A, 0x10, 0x0D, 0x17, 0x26,
-    0x63, 0x47, 0x4C, 0x66, 0x63, 0x4D, 0x46, 0x36, 0x27, 0x26, 0x4F, 0x5F, 0x53, 0x2A, 0x28, 0x42,
-    0x18, 0x49, 0x51, 0x4C, 0x39, 0x2B, 0x6C, 0x84, 0x98, 0x78, 0x52, 0x6F, 0x4C, 0x13, 0x1A, 0x27,
-    0x30, 0x28, 0x16, 0x16, 0x1B, 0x19, 0x0C, 0x08, 0x0A, 0x0C, 0x0D, 0x0A, 0x0B, 0x0B, 0x0E, 0x0D,
-    0x1F, 0x1F, 0x31, 0x3B, 0x4A, 0x4F, 0x31, 0x4A, 0x5A, 0x26, 0x1B, 0x24, 0x1C, 0x50, 0xB6, 0xB3,
-    0xA8, 0x1E, 0x31, 0x3C, 0x63, 0x63, 0x2A, 0x16, 0x0C, 0x0E, 0x0F, 0x0E, 0x0B, 0x08, 0x0A, 0x0A,
-    0x07, 0x24, 0x19, 0x0F, 0x0C, 0x0C, 0x0A, 0x11, 0x0E, 0x0E, 0x0F, 0x0F, 0x0D, 0x0F, 0x0F, 0x27,
-    0x2B, 0x5E, 0xA4, 0x9A, 0x7E, 0x8E, 0x8D, 0xBB, 0xA5, 0x77, 0x5E, 0x58, 0x2F, 0x3C, 0x41, 0x52,
-    0x4E, 0x7D, 0x45, 0x8E, 0x83, 0x70, 0x80, 0x64, 0xA0, 0xAE, 0xC0, 0xA1, 0x82, 0x6B, 0x6F, 0x3D,
-    0x43, 0x31, 0x3C, 0x1A, 0x2F, 0x2D, 0x17, 0x1D, 0x1A, 0x10, 0x14, 0x11, 0x08, 0x0D, 0x0F, 0x09,
-    0x12, 0x12, 0x1E, 0x32, 0x44, 0x4B, 0x5D, 0x40, 0x26, 0x3E, 0x2A, 0x4C, 0x25, 0x31, 0x42, 0x39,
-    0x76, 0xC8, 0x8E, 0x1B, 0x1C, 0x2B, 0x33, 0x1E, 0x14, 0x09, 0x0A, 0x0A, 0x07, 0x0C, 0x0E, 0x08,
-    0x08, 0x09, 0x06, 0x08, 0x13, 0x11, 0x04, 0x20, 0x4A, 0x0B, 0x09, 0x0A, 0x0A, 0x0C, 0x0B, 0x0D,
-    0x16, 0x2C, 0x30, 0x5E, 0xAB, 0x9D, 0xD5, 0xC3, 0xAC, 0xC9, 0xA0, 0x47, 0x5A, 0x4B, 0x4D, 0x7F,
-    0x4C, 0x4E, 0x59, 0x5B, 0x3C, 0x8F, 0xB7, 0xA5, 0x98, 0xA0, 0xB8, 0x91, 0x8B, 0x94, 0xA6, 0x92,
-    0x6C, 0x5E, 0x72, 0x0A, 0x1B, 0x1C, 0x1E, 0x2D, 0x22, 0x15, 0x16, 0x11, 0x0E, 0x12, 0x0C, 0x0E,
-    0x24, 0x24, 0x17, 0x21, 0x3F, 0x43, 0x3A, 0x2E, 0x37, 0x2D, 0x34, 0x22, 0x15, 0x64, 0x41, 0x26,
-    0x27, 0x18, 0x56, 0x66, 0x30, 0x0C, 0x0F, 0x12, 0x15, 0x12, 0x0F, 0x0C, 0x0B, 0x0E, 0x09, 0x06,
-    0x07, 0x08, 0x07, 0x0D, 0x0F, 0x09, 0x0F, 0x10, 0x06, 0x13, 0x1D, 0x0F, 0x10, 0x19, 0x0F, 0x07,
-    0x0C, 0x0C, 0x1A, 0x40, 0x67, 0x8C, 0x49, 0xB3, 0xE3, 0xB1, 0xBB, 0xBC, 0xA0, 0x33, 0x0B, 0x1D,
-    0x48, 0xA3, 0x7F, 0x4D, 0x65, 0xB6, 0x93, 0x9E, 0xA7, 0xA2, 0x6A, 0x66, 0x6D, 0x5A, 0x27, 0x9D,
-    0x7E, 0x4E, 0x55, 0x44, 0x2D, 0x1B, 0x29, 0x1D, 0x17, 0x36, 0x21, 0x14, 0x0F, 0x0B, 0x16, 0x13,
-    0x0B, 0x0B, 0x14, 0x2C, 0x25, 0x37, 0x42, 0x3A, 0x24, 0x22, 0x2A, 0x4C, 0x48, 0x35, 0x1C, 0x5D,
-    0x52, 0x3F, 0x46, 0x4B, 0x56, 0x62, 0x3F, 0x0F, 0x10, 0x16, 0x18, 0x15, 0x10, 0x0F, 0x0F, 0x0E,
-    0x0B, 0x09, 0x0D, 0x0A, 0x0A, 0x15, 0x28, 0x11, 0x06, 0x0A, 0x0B, 0x17, 0x37, 0x0B, 0x17, 0x30,
-    0x0E, 0x0C, 0x12, 0x12, 0x23, 0x97, 0xB6, 0x66, 0x87, 0x9B, 0xD4, 0xE1, 0xC8, 0xBE, 0xC6, 0x74,
-    0x15, 0x2E, 0x3F, 0x7A, 0x7C, 0x6B, 0xA5, 0xCE, 0xD1, 0xBC, 0xBE, 0xA9, 0x69, 0x3B, 0x5A, 0x8A,
-    0x6A, 0x5A, 0x7A, 0x53, 0x38, 0x33, 0x34, 0x24, 0x3C, 0x30, 0x10, 0x1B, 0x33, 0x14, 0x0E, 0x09,
-    0x12, 0x14, 0x0B, 0x08, 0x11, 0x21, 0x21, 0x2F, 0x21, 0x2A, 0x26, 0x27, 0x50, 0x73, 0x35, 0x1D,
-    0x41, 0x35, 0x3C, 0x62, 0x5E, 0x4D, 0x35, 0x23, 0x2A, 0x21, 0x0F, 0x0B, 0x17, 0x13, 0x0C, 0x10,
-    0x0C, 0x06, 0x09, 0x06, 0x07, 0x18, 0x1E, 0x0C, 0x2E, 0x27, 0x35, 0x22, 0x06, 0x0B, 0x21, 0x08,
-    0x09, 0x0F, 0x0C, 0x0B, 0x09, 0x0C, 0x52, 0x72, 0xB0, 0x74, 0xA7, 0x9B, 0xD2, 0xDE, 0xD2, 0xD1,
-    0xDD, 0x92, 0x18, 0x7C, 0x7A, 0xA1, 0xB9, 0xBD, 0xDC, 0xC5, 0xBC, 0xD0, 0xC2, 0xAB, 0x80, 0x6A,
-    0x54, 0x42, 0x73, 0x5B, 0x4C, 0x37, 0x23, 0x1A, 0x12, 0x1C, 0x18, 0x39, 0x3F, 0x12, 0x29, 0x19,
-    0x06, 0x0C, 0x06, 0x07, 0x07, 0x05, 0x23, 0x33, 0x21, 0x1F, 0x2E, 0x30, 0x32, 0x4F, 0x69, 0x7C,
-    0x52, 0x27, 0x2E, 0x60, 0x9F, 0xB2, 0xC3, 0xA4, 0x86, 0x7B, 0x80, 0x53, 0x2E, 0x24, 0x29, 0x22,
-    0x14, 0x18, 0x10, 0x09, 0x0D, 0x0E, 0x07, 0x17, 0x3E, 0x16, 0x1C, 0x29, 0x43, 0x2C, 0x08, 0x0F,
-    0x0C, 0x0E, 0x19, 0x29, 0x17, 0x10, 0x13, 0x15, 0x3E, 0x7E, 0xA6, 0xCF, 0xC5, 0xBC, 0xD4, 0xDE,
-    0xF5, 0xE3, 0xCD, 0x7D, 0x37, 0x59, 0xAE, 0xD7, 0xD4, 0xD3, 0xDC, 0xDB, 0xDB, 0xC6, 0xC2, 0xE4,
-    0xAF, 0x2E, 0x18, 0x17, 0x62, 0x8D, 0x78, 0x5F, 0x3D, 0x43, 0x37, 0x2B, 0x2A, 0x3F, 0x5B, 0x31,
-    0x30, 0x2C, 0x12, 0x18, 0x16, 0x11, 0x14, 0x09, 0x1B, 0x1B, 0x2E, 0x28, 0x26, 0x26, 0x3A, 0x60,
-    0x4E, 0x5B, 0x40, 0x13, 0x1F, 0x34, 0x6D, 0x72, 0x6C, 0x79, 0x6E, 0x84, 0x75, 0x4E, 0x36, 0x27,
-    0x34, 0x0F, 0x0C, 0x18, 0x12, 0x08, 0x0F, 0x05, 0x1E, 0x3A, 0x2F, 0x1D, 0x13, 0x4D, 0xBB, 0x25,
-    0x05, 0x0C, 0x09, 0x07, 0x0E, 0x17, 0x0F, 0x0B, 0x0D, 0x0C, 0x3B, 0x51, 0xA8, 0x9C, 0x46, 0x8A,
-    0xE3, 0xE3, 0xE8, 0xD7, 0x7B, 0x45, 0x1B, 0x34, 0x96, 0xDC, 0xE3, 0xDC, 0xE7, 0xCF, 0xC6, 0xC6,
-    0xD7, 0xC1, 0xA3, 0x32, 0x49, 0x25, 0x71, 0x69, 0x72, 0x4A, 0x3C, 0x4D, 0x33, 0x19, 0x10, 0x3A,
-    0x5A, 0x20, 0x1F, 0x2B, 0x1E, 0x0E, 0x1A, 0x14, 0x10, 0x08, 0x15, 0x22, 0x25, 0x2F, 0x23, 0x15,
-    0x2D, 0x2E, 0x4A, 0x59, 0x86, 0x41, 0x19, 0x72, 0x69, 0x73, 0x81, 0x7F, 0x59, 0x51, 0x29, 0x42,
-    0x87, 0x36, 0x36, 0x15, 0x13, 0x16, 0x10, 0x10, 0x25, 0x0F, 0x44, 0xBC, 0x8F, 0x3A, 0x21, 0x28,
-    0x4D, 0x1D, 0x0C, 0x10, 0x0E, 0x0C, 0x0F, 0x0B, 0x0D, 0x10, 0x15, 0x13, 0x4E, 0x77, 0x97, 0x5F,
-    0x94, 0xCC, 0xE8, 0xE3, 0xDF, 0xD2, 0x55, 0x4B, 0x86, 0x69, 0xB4, 0xE0, 0xE7, 0xE3, 0xE3, 0xD2,
-    0xCB, 0xD9, 0xDE, 0xBA, 0xC2, 0xB4, 0x41, 0x62, 0xA6, 0x75, 0x85, 0x51, 0x3A, 0x53, 0x1C, 0x2A,
-    0x21, 0x43, 0x4A, 0x2A, 0x23, 0x20, 0x15, 0x12, 0x10, 0x12, 0x12, 0x10, 0x1E, 0x36, 0x35, 0x19,
-    0x0C, 0x18, 0x26, 0x26, 0x3C, 0x49, 0x64, 0x33, 0x46, 0x7F, 0x71, 0x6D, 0x7E, 0x6D, 0x44, 0x40,
-    0x2B, 0x30, 0x8B, 0x3A, 0x19, 0x25, 0x1A, 0x11, 0x10, 0x13, 0x21, 0x19, 0x3F, 0xBC, 0x80, 0x55,
-    0x4F, 0x14, 0x09, 0x10, 0x0C, 0x0D, 0x0F, 0x11, 0x0F, 0x12, 0x0E, 0x11, 0x1D, 0x14, 0x77, 0xB8,
-    0xB4, 0x6A, 0x88, 0xDE, 0xE3, 0xEE, 0xE2, 0xE3, 0x93, 0x53, 0xBD, 0xC6, 0xE7, 0xDE, 0xEC, 0xEC,
-    0xE5, 0xE0, 0xCB, 0xD5, 0xD1, 0xDB, 0xE0, 0xD1, 0x92, 0xAC, 0xAF, 0xC8, 0xA0, 0xA6, 0xA8, 0x72,
-    0x59, 0x3D, 0x1F, 0x2F, 0x43, 0x44, 0x24, 0x17, 0x07, 0x0D, 0x0D, 0x0D, 0x13, 0x0E, 0x19, 0x27,
-    0x1C, 0x17, 0x23, 0x1E, 0x3A, 0x3A, 0x4D, 0x3E, 0x5B, 0x3F, 0xA5, 0x90, 0x6D, 0x3D, 0x62, 0x87,
-    0x78, 0x51, 0x22, 0x10, 0x1D, 0x22, 0x0B, 0x1C, 0x26, 0x18, 0x09, 0x11, 0x18, 0x00, 0x3A, 0x9A,
-    0x84, 0x5E, 0x32, 0x0C, 0x29, 0x1D, 0x11, 0x11, 0x0F, 0x0C, 0x0B, 0x12, 0x0E, 0x0C, 0x26, 0x47,
-    0xBA, 0xD9, 0xE4, 0x6A, 0xA4, 0xD4, 0xD7, 0xF6, 0xF5, 0xE2, 0xC7, 0x95, 0xA4, 0xCC, 0xDD, 0xE6,
-    0xE2, 0xE5, 0xE4, 0xE6, 0xE2, 0xCD, 0xC7, 0xE1, 0xCB, 0xCC, 0xA2, 0xB5, 0xB8, 0xAA, 0xA0, 0x81,
-    0xA2, 0x6C, 0x4E, 0x3A, 0x26, 0x3B, 0x5B, 0x41, 0x2B, 0x1D, 0x13, 0x04, 0x07, 0x07, 0x08, 0x0A,
-    0x2B, 0x28, 0x18, 0x26, 0x33, 0x1D, 0x4E, 0x73, 0x40, 0x51, 0x80, 0x46, 0x7D, 0x9C, 0x89, 0x6C,
-    0x89, 0xAB, 0x89, 0x4B, 0x2F, 0x7A, 0x70, 0x10, 0x11, 0x18, 0x29, 0x1A, 0x11, 0x14, 0x1D, 0x35,
-    0x62, 0xC8, 0xC9, 0x6E, 0x55, 0x3E, 0x2D, 0x2F, 0x0A, 0x13, 0x13, 0x12, 0x13, 0x0F, 0x13, 0x17,
-    0x1C, 0x30, 0xC1, 0xE5, 0xCE, 0xA5, 0xE0, 0xD6, 0xF1, 0xEB, 0xEC, 0xE7, 0xDE, 0xEA, 0xD6, 0xCC,
-    0xE5, 0xEF, 0xE7, 0xED, 0xE4, 0xEA, 0xEA, 0xD1, 0xE1, 0xEC, 0xE3, 0xBB, 0x6A, 0x99, 0xC5, 0xB1,
-    0xA8, 0x7F, 0x9B, 0x72, 0x67, 0x5E, 0x88, 0x54, 0x30, 0x33, 0x5E, 0x2C, 0x1E, 0x15, 0x0A, 0x0C,
-    0x09, 0x08, 0x1D, 0x21, 0x1F, 0x10, 0x21, 0x20, 0x2F, 0x41, 0x0F, 0x33, 0x79, 0x38, 0x5F, 0xC4,
-    0xAF, 0x62, 0x94, 0x69, 0x46, 0x35, 0x59, 0xD7, 0x69, 0x2C, 0x15, 0x13, 0x1A, 0x16, 0x0F, 0x0D,
-    0x28, 0x6B, 0xC3, 0xD8, 0xCC, 0xA2, 0x4D, 0x1E, 0x13, 0x45, 0x35, 0x0A, 0x0C, 0x0B, 0x0C, 0x0E,
-    0x0D, 0x15, 0x76, 0x52, 0xD6, 0xBA, 0xB8, 0xDA, 0xDF, 0xF3, 0xEA, 0xEC, 0xE2, 0xD4, 0xE0, 0xB3,
-    0x99, 0xD6, 0xDD, 0xD9, 0xDC, 0xED, 0xDC, 0xEE, 0xEA, 0xD8, 0xDD, 0xD6, 0xD9, 0xCF, 0x92, 0x97,
-    0xD3, 0xC5, 0xB7, 0x68, 0x65, 0x5C, 0x6B, 0x3C, 0x6A, 0x4A, 0x1D, 0x1E, 0x30, 0x26, 0x20, 0x12,
-    0x05, 0x06, 0x03, 0x02, 0x15, 0x1D, 0x12, 0x0F, 0x1C, 0x28, 0x30, 0x17, 0x14, 0x61, 0x74, 0x4D,
-    0x6B, 0x6A, 0x6A, 0x73, 0x4D, 0x66, 0x3D, 0x25, 0x91, 0xD0, 0x3E, 0x37, 0x20, 0x23, 0x19, 0x11,
-    0x19, 0x35, 0x2C, 0x70, 0xC8, 0xED, 0xD4, 0xC5, 0x9B, 0x87, 0x4B, 0x1A, 0x33, 0x17, 0x14, 0x17,
-    0x1A, 0x21, 0x17, 0x33, 0xA7, 0x68, 0xC0, 0xCF, 0xEE, 0xD6, 0xD4, 0xF0, 0xEC, 0xF0, 0xF1, 0xED,
-    0xE6, 0xD5, 0xCA, 0xEA, 0xEF, 0xE4, 0xDA, 0xEA, 0xE5, 0xEC, 0xD6, 0xDC, 0xE5, 0xD8, 0xEC, 0xD2,
-    0xC0, 0xD6, 0xCB, 0xC3, 0xC4, 0x78, 0x62, 0xA0, 0x93, 0x3F, 0x47, 0x25, 0x31, 0x1D, 0x09, 0x0A,
-    0x0C, 0x07, 0x0A, 0x07, 0x06, 0x06, 0x0E, 0x0E, 0x0C, 0x0E, 0x09, 0x19, 0x1F, 0x25, 0x41, 0x62,
-    0x2D, 0x23, 0x57, 0x40, 0x4E, 0x74, 0x63, 0x5C, 0x37, 0x2E, 0x77, 0x98, 0x1E, 0x29, 0x0F, 0x0C,
-    0x0F, 0x10, 0x0F, 0x35, 0x3E, 0x52, 0xAC, 0xEE, 0xFF, 0xEF, 0xBB, 0x7F, 0x70, 0x27, 0x0D, 0x0D,
-    0x0E, 0x11, 0x13, 0x0D, 0x10, 0x1E, 0x50, 0x69, 0x67, 0xB9, 0xEE, 0xF5, 0xEF, 0xEE, 0xF1, 0xF0,
-    0xEB, 0xEB, 0xE6, 0xF1, 0xDB, 0xEA, 0xE6, 0xDD, 0xE6, 0xE0, 0xD9, 0xD4, 0xE6, 0xDF, 0xE8, 0xE4,
-    0xD3, 0xDD, 0xC2, 0xC1, 0xCB, 0xC5, 0xAC, 0x51, 0x5C, 0x97, 0x64, 0x3E, 0x61, 0x16, 0x18, 0x06,
-    0x09, 0x08, 0x08, 0x06, 0x06, 0x0B, 0x0F, 0x08, 0x0D, 0x11, 0x0D, 0x10, 0x19, 0x1F, 0x20, 0x3D,
-    0x51, 0x2F, 0x4A, 0x52, 0x3A, 0x6B, 0xD3, 0xCC, 0xAA, 0x68, 0x34, 0x51, 0x9D, 0x94, 0x23, 0x16,
-    0x0E, 0x09, 0x11, 0x10, 0x0B, 0x0C, 0x07, 0x19, 0x80, 0xEA, 0xB6, 0x64, 0x59, 0x4F, 0x7C, 0x58,
-    0x3B, 0x25, 0x10, 0x0A, 0x13, 0x16, 0x13, 0x0E, 0x1D, 0x6D, 0x47, 0xBC, 0xF9, 0xF7, 0xF2, 0xEE,
-    0xF1, 0xEB, 0xE5, 0xE4, 0xF1, 0xFA, 0xD7, 0xCA, 0xE4, 0x95, 0x84, 0xD0, 0xE4, 0xF5, 0xE5, 0xE7,
-    0xEF, 0xE5, 0xDC, 0xDB, 0xD0, 0xD7, 0xD1, 0xC2, 0x96, 0x5C, 0x58, 0x7F, 0x4E, 0x29, 0x28, 0x12,
-    0x0B, 0x0D, 0x0B, 0x0E, 0x12, 0x18, 0x09, 0x14, 0x1A, 0x10, 0x19, 0x1E, 0x2D, 0x1B, 0x11, 0x11,
-    0x26, 0x56, 0x69, 0x56, 0x49, 0x5D, 0x52, 0x52, 0xB3, 0x93, 0x64, 0x5C, 0x3A, 0x56, 0xB3, 0x82,
-    0x12, 0x1B, 0x16, 0x14, 0x15, 0x05, 0x1A, 0x24, 0x5F, 0x78, 0x5C, 0xB2, 0xBA, 0x8E, 0x68, 0x42,
-    0x72, 0x50, 0x47, 0x1D, 0x11, 0x0B, 0x13, 0x18, 0x14, 0x12, 0x17, 0x35, 0x32, 0xAB, 0xFD, 0xEC,
-    0xF4, 0xF8, 0xF5, 0xE6, 0xDE, 0xF5, 0xF5, 0xE3, 0xC5, 0xE8, 0xEE, 0xD0, 0xC5, 0xEC, 0xF1, 0xE9,
-    0xE7, 0xED, 0xEB, 0xEE, 0xE0, 0xCD, 0xDF, 0xE2, 0xD3, 0xC9, 0x88, 0x54, 0x67, 0x59, 0x28, 0x18,
-    0x09, 0x16, 0x17, 0x11, 0x13, 0x1F, 0x1E, 0x25, 0x0D, 0x0C, 0x14, 0x18, 0x18, 0x20, 0x1F, 0x14,
-    0x1B, 0x0F, 0x0C, 0x1B, 0x40, 0x2D, 0x41, 0x46, 0x33, 0x42, 0x71, 0x88, 0x57, 0x01, 0x13, 0x35,
-    0x5B, 0x0D, 0x12, 0x0F, 0x09, 0x11, 0x30, 0x7C, 0xAC, 0xD5, 0xEF, 0xE8, 0xD2, 0xF3, 0xFD, 0xF9,
-    0xEF, 0xE3, 0xDD, 0x6A, 0x03, 0x0F, 0x0E, 0x0D, 0x0A, 0x0E, 0x11, 0x0F, 0x10, 0x13, 0x4B, 0xDE,
-    0xE5, 0xEE, 0xED, 0xF5, 0xF5, 0xE0, 0xE9, 0xF3, 0xD0, 0x8A, 0xC1, 0xFA, 0xF0, 0xF4, 0xE9, 0xF4,
-    0xE9, 0xD8, 0xDF, 0xEF, 0xEB, 0xE8, 0xE8, 0xD2, 0xB9, 0xD2, 0xDF, 0xCB, 0x95, 0x86, 0x3C, 0x23,
-    0x1F, 0x1A, 0x3B, 0x2C, 0x23, 0x1A, 0x0B, 0x0E, 0x1A, 0x14, 0x10, 0x0C, 0x10, 0x10, 0x20, 0x2A,
-    0x1E, 0x1B, 0x43, 0x35, 0x30, 0x34, 0x3C, 0x30, 0x41, 0x2D, 0x14, 0x43, 0x76, 0xA3, 0x8D, 0x54,
-    0x39, 0x4B, 0x46, 0x31, 0x1A, 0x18, 0x30, 0x66, 0xB3, 0xF1, 0xEF, 0xFD, 0xF6, 0xF9, 0xFD, 0xF3,
-    0xF6, 0xF5, 0xF8, 0xFE, 0xED, 0xC1, 0x32, 0x17, 0x21, 0x1B, 0x38, 0x20, 0x1C, 0x1A, 0x16, 0x2E,
-    0x7B, 0xF2, 0xF3, 0xF5, 0xF5, 0xF8, 0xF5, 0xEC, 0xF3, 0xEB, 0xE3, 0xEA, 0xFA, 0xF3, 0xF5, 0xF8,
-    0xF2, 0xF0, 0xF6, 0xEF, 0xEB, 0xF3, 0xF1, 0xEA, 0xED, 0xE1, 0xC1, 0xC8, 0xD8, 0xC7, 0xB3, 0xA5,
-    0x70, 0x3B, 0x64, 0x5D, 0x42, 0x2F, 0x1A, 0x43, 0x13, 0x09, 0x10, 0x0F, 0x10, 0x0A, 0x0E, 0x0E,
-    0x1D, 0x26, 0x35, 0x1B, 0x37, 0x34, 0x40, 0x3E, 0x22, 0x1C, 0x0F, 0x13, 0x26, 0x6A, 0x2F, 0x56,
-    0x63, 0xAD, 0x5F, 0x59, 0x65, 0x2D, 0x13, 0x0C, 0x39, 0xB9, 0xEA, 0xF2, 0xF4, 0xF5, 0xF8, 0xF4,
-    0xF1, 0xF4, 0xF1, 0xF8, 0xFA, 0xF5, 0xEF, 0xF7, 0xC9, 0x45, 0x21, 0x1E, 0x37, 0x17, 0x11, 0x17,
-    0x0E, 0x42, 0x8F, 0xF3, 0xF3, 0xF6, 0xF7, 0xF3, 0xF2, 0xF2, 0xE3, 0xDA, 0xEE, 0xEF, 0xF0, 0xF0,
-    0xF7, 0xF7, 0xF2, 0xE7, 0xEE, 0xF6, 0xF4, 0xEB, 0xE7, 0xED, 0xEE, 0xD6, 0xB2, 0xAB, 0xC0, 0xBB,
-    0xB8, 0x7C, 0x50, 0x56, 0x38, 0x36, 0x0F, 0x14, 0x13, 0x1D, 0x14, 0x08, 0x0A, 0x07, 0x0D, 0x0A,
-    0x0F, 0x18, 0x29, 0x33, 0x43, 0x2C, 0x43, 0x27, 0x2F, 0x50, 0x32, 0x15, 0x26, 0x37, 0x56, 0x46,
-    0x1A, 0x53, 0x49, 0x7F, 0x54, 0x52, 0x83, 0x2E, 0x25, 0x68, 0xAD, 0xEC, 0xF7, 0xF2, 0xF8, 0xF4,
-    0xF3, 0xF3, 0xF6, 0xF7, 0xF5, 0xF8, 0xFA, 0xF2, 0xF9, 0xF8, 0xFD, 0x9C, 0x1C, 0x21, 0x22, 0x22,
-    0x20, 0x1C, 0x17, 0x29, 0x6B, 0xF2, 0xF9, 0xF9, 0xF5, 0xF5, 0xF0, 0xEF, 0xE9, 0xED, 0xF5, 0xF7,
-    0xF7, 0xF4, 0xF6, 0xF8, 0xF2, 0xF8, 0xF2, 0xEB, 0xEC, 0xEF, 0xEE, 0xEA, 0xE9, 0xCB, 0x9D, 0xDE,
-    0xD1, 0xC9, 0xC0, 0x7B, 0x77, 0x26, 0x1F, 0x13, 0x23, 0x12, 0x11, 0x2D, 0x2A, 0x17, 0x0E, 0x0D,
-    0x15, 0x16, 0x14, 0x26, 0x21, 0x35, 0x31, 0x24, 0x27, 0x33, 0x44, 0x58, 0x2E, 0x16, 0x1A, 0x12,
-    0x63, 0x2F, 0x2E, 0x4D, 0x22, 0x6B, 0x80, 0x56, 0x7E, 0x29, 0x16, 0x8A, 0xFF, 0xE8, 0xF1, 0xFA,
-    0xF5, 0xF7, 0xF7, 0xEB, 0xF5, 0xF9, 0xF5, 0xFA, 0xF7, 0xF5, 0xF9, 0xFA, 0xF4, 0xF5, 0x62, 0x3B,
-    0x41, 0x24, 0x1D, 0x1B, 0x18, 0x20, 0xB6, 0xFE, 0xF6, 0xF8, 0xF0, 0xEF, 0xE1, 0xEF, 0xF4, 0xF6,
-    0xEF, 0xF4, 0xF9, 0xF0, 0xF5, 0xF7, 0xE9, 0xE1, 0xF0, 0xF5, 0xE9, 0xEB, 0xED, 0xE7, 0xE7, 0xD8,
-    0xAF, 0xD8, 0xB5, 0xBA, 0xC7, 0x92, 0x8B, 0x26, 0x12, 0x1D, 0x16, 0x23, 0x50, 0x58, 0x59, 0x38,
-    0x08, 0x0D, 0x09, 0x09, 0x0A, 0x0C, 0x10, 0x1B, 0x18, 0x22, 0x45, 0x3D, 0x3F, 0x62, 0x4C, 0x28,
-    0x32, 0x22, 0x3D, 0x47, 0x5A, 0x36, 0x89, 0x83, 0x4A, 0x89, 0xBE, 0x60, 0x68, 0xCC, 0xED, 0xF1,
-    0xF6, 0xF9, 0xF6, 0xF9, 0xF7, 0xF3, 0xF4, 0xFA, 0xF5, 0xF8, 0xF6, 0xF5, 0xF7, 0xF8, 0xF3, 0xFF,
-    0x9C, 0x1A, 0x1E, 0x19, 0x1B, 0x22, 0x13, 0x57, 0xF3, 0xF3, 0xFA, 0xF4, 0xF3, 0xEE, 0xE5, 0xEB,
-    0xF0, 0xF6, 0xF1, 0xF2, 0xF7, 0xF6, 0xF2, 0xEF, 0xEE, 0xDC, 0xEA, 0xEF, 0xF2, 0xEF, 0xEE, 0xEA,
-    0xEB, 0xCC, 0x89, 0xC5, 0xC2, 0xC3, 0xC9, 0xC3, 0x40, 0x2B, 0x3F, 0x16, 0x1A, 0x25, 0x45, 0x52,
-    0x4A, 0x27, 0x21, 0x09, 0x0A, 0x09, 0x0E, 0x09, 0x09, 0x0B, 0x0D, 0x1B, 0x20, 0x25, 0x27, 0x56,
-    0x6C, 0x71, 0x61, 0x50, 0x81, 0xBE, 0xAF, 0x7F, 0x73, 0x15, 0x11, 0x4E, 0x77, 0x63, 0x8A, 0xF4,
-    0xEB, 0xF7, 0xFA, 0xF6, 0xF2, 0xF3, 0xF7, 0xF7, 0xF4, 0xF8, 0xF4, 0xF0, 0xFA, 0xFA, 0xF8, 0xF7,
-    0xF7, 0xFF, 0x8B, 0x1B, 0x21, 0x21, 0x20, 0x23, 0x1A, 0x65, 0xDD, 0xDB, 0xF7, 0xFB, 0xF9, 0xF0,
-    0xC8, 0xE8, 0xFA, 0xF6, 0xF8, 0xF3, 0xF5, 0xF3, 0xF2, 0xF1, 0xEF, 0xF3, 0xF3, 0xEE, 0xEE, 0xEB,
-    0xF1, 0xF8, 0xEE, 0xC4, 0x97, 0xCE, 0xCA, 0xB9, 0xBB, 0xC4, 0x84, 0x36, 0xA1, 0x45, 0x19, 0x29,
-    0x2A, 0x5E, 0x71, 0x35, 0x19, 0x10, 0x0A, 0x0F, 0x0D, 0x09, 0x11, 0x0D, 0x0E, 0x09, 0x07, 0x1C,
-    0x24, 0x2E, 0x3A, 0x6F, 0x8F, 0x7E, 0x77, 0xA2, 0xB1, 0xF1, 0xCE, 0xAE, 0x4F, 0x0F, 0x20, 0x1B,
-    0x30, 0xE0, 0xEE, 0xF0, 0xF4, 0xEE, 0xF2, 0xF1, 0xF5, 0xF4, 0xF7, 0xF3, 0xF5, 0xF3, 0xF8, 0xFB,
-    0xF8, 0xF7, 0xFB, 0xFB, 0x7F, 0x24, 0x14, 0x16, 0x14, 0x14, 0x13, 0x22, 0xAA, 0xF7, 0xF6, 0xF8,
-    0xFA, 0xF7, 0xEF, 0xF5, 0xF3, 0xEE, 0xEE, 0xF4, 0xF8, 0xF7, 0xF6, 0xF8, 0xF3, 0xF4, 0xF2, 0xFB,
-    0xF2, 0xED, 0xF3, 0xEE, 0xDA, 0xD4, 0xE7, 0xB2, 0xC9, 0xBC, 0xB0, 0xC0, 0x8A, 0x46, 0x78, 0x4F,
-    0x19, 0x2B, 0x37, 0x24, 0x34, 0x1D, 0x0A, 0x0C, 0x06, 0x0A, 0x07, 0x07, 0x1F, 0x1D, 0x33, 0x1E,
-    0x25, 0x25, 0x2F, 0x30, 0x4A, 0x44, 0x56, 0x6D, 0x3E, 0x5F, 0xA5, 0xAD, 0xD9, 0xEB, 0xD0, 0x5A,
-    0x6E, 0x42, 0x3F, 0xD7, 0xFB, 0xF2, 0xEF, 0xED, 0xF8, 0xF5, 0xF3, 0xF8, 0xF5, 0xF2, 0xF7, 0xF2,
-    0xF5, 0xF9, 0xF7, 0xF5, 0xF6, 0xFD, 0x8F, 0x48, 0x25, 0x1E, 0x22, 0x3C, 0x22, 0x1E, 0x66, 0xEC,
-    0xF6, 0xF7, 0xF4, 0xEF, 0xC4, 0xF0, 0xF6, 0xF6, 0xF4, 0xF7, 0xFC, 0xF6, 0xF3, 0xE1, 0xF3, 0xF3,
-    0xF6, 0xFA, 0xF0, 0xEE, 0xEE, 0xEE, 0xED, 0xE1, 0xBF, 0xBF, 0xD7, 0xE2, 0xDA, 0xD7, 0x8A, 0x80,
-    0xA6, 0x6D, 0x4D, 0x1B, 0x3E, 0x1B, 0x0E, 0x0B, 0x0D, 0x0A, 0x0C, 0x0A, 0x07, 0x09, 0x1C, 0x12,
-    0x3B, 0x34, 0x2F, 0x3C, 0x33, 0x26, 0x20, 0x31, 0x13, 0x0B, 0x1C, 0x24, 0xA0, 0x8F, 0xA7, 0xBD,
-    0x9D, 0x64, 0xB9, 0x86, 0xA4, 0xDE, 0xEF, 0xF6, 0xF8, 0xF6, 0xF9, 0xF5, 0xF3, 0xF7, 0xF4, 0xF6,
-    0xF8, 0xEF, 0xF5, 0xF6, 0xF8, 0xF7, 0xF3, 0xF1, 0x6C, 0x5D, 0x1A, 0x1E, 0x15, 0x28, 0x19, 0x0A,
-    0x59, 0xF5, 0xF4, 0xF5, 0xEA, 0xF4, 0xF4, 0xF2, 0xF6, 0xF1, 0xF4, 0xF7, 0xF8, 0xF3, 0xE9, 0xD3,
-    0xEF, 0xF3, 0xF9, 0xF7, 0xEC, 0xED, 0xE4, 0xEC, 0xDF, 0xDA, 0xB8, 0xDB, 0xCC, 0xD0, 0xA8, 0xB2,
-    0x88, 0x51, 0x5A, 0x4B, 0x43, 0x11, 0x0E, 0x0E, 0x07, 0x0A, 0x09, 0x07, 0x08, 0x04, 0x06, 0x05,
-    0x18, 0x20, 0x50, 0x42, 0x1F, 0x29, 0x44, 0x48, 0x47, 0x6F, 0x50, 0x36, 0x59, 0x3E, 0x8C, 0xBD,
-    0xD7, 0xC2, 0x89, 0x4F, 0x89, 0x88, 0xB0, 0xF8, 0xF9, 0xFB, 0xFA, 0xF7, 0xF9, 0xF9, 0xF6, 0xF3,
-    0xF4, 0xF6, 0xF5, 0xF8, 0xEF, 0xF5, 0xFA, 0xF9, 0xFC, 0xD2, 0x54, 0x8B, 0x22, 0x42, 0x35, 0x5D,
-    0x1D, 0x17, 0x8D, 0xFF, 0xF2, 0xF9, 0xED, 0xF3, 0xFB, 0xF5, 0xED, 0xF1, 0xF3, 0xF5, 0xF6, 0xF4,
-    0xF6, 0xF3, 0xF5, 0xF8, 0xFC, 0xF6, 0xF1, 0xF4, 0xF1, 0xE9, 0xF0, 0xD9, 0xBE, 0xE3, 0xD3, 0xC6,
-    0x8D, 0x92, 0x99, 0x70, 0x21, 0x1E, 0x10, 0x0D, 0x0C, 0x0A, 0x0B, 0x08, 0x06, 0x07, 0x05, 0x06,
-    0x0A, 0x09, 0x23, 0x26, 0x2D, 0x2A, 0x29, 0x37, 0x2B, 0x38, 0x50, 0x5E, 0x78, 0x67, 0x72, 0x5B,
-    0x5A, 0x6C, 0x72, 0x58, 0x4A, 0x24, 0x2E, 0x54, 0x79, 0xE6, 0xF1, 0xF1, 0xF5, 0xF6, 0xF0, 0xF2,
-    0xFA, 0xF5, 0xF4, 0xF6, 0xF2, 0xF3, 0xEE, 0xF7, 0xF7, 0xFA, 0xFF, 0x82, 0x97, 0x7A, 0x11, 0x27,
-    0x22, 0x29, 0x1D, 0x10, 0x6C, 0xF9, 0xF1, 0xF2, 0xF8, 0xFA, 0xF7, 0xF4, 0xEC, 0xF5, 0xF2, 0xF8,
-    0xF0, 0xF7, 0xF7, 0xF6, 0xFA, 0xF9, 0xF8, 0xED, 0xED, 0xF4, 0xD8, 0xD0, 0xB9, 0x82, 0xE1, 0xED,
-    0xD2, 0xB5, 0x8C, 0x6B, 0x4B, 0x1A, 0x12, 0x0D, 0x0D, 0x0C, 0x07, 0x08, 0x07, 0x07, 0x06, 0x06,
-    0x04, 0x06, 0x0A, 0x07, 0x21, 0x1E, 0x34, 0x4F, 0x41, 0x25, 0x1F, 0x5F, 0x99, 0x62, 0x89, 0xC6,
-    0x97, 0x8D, 0x9B, 0x99, 0x8E, 0x92, 0x65, 0x15, 0x17, 0x0B, 0x7A, 0xEE, 0xF2, 0xF4, 0xF8, 0xF9,
-    0xF2, 0xF2, 0xF3, 0xF5, 0xF2, 0xF6, 0xF6, 0xF5, 0xF6, 0xF9, 0xF8, 0xFD, 0xB6, 0x3A, 0x53, 0x0C,
-    0x1D, 0x14, 0x13, 0x20, 0x25, 0x07, 0x5C, 0xF8, 0xF3, 0xF2, 0xF8, 0xF4, 0xF4, 0xF3, 0xFB, 0xF3,
-    0xF0, 0xF6, 0xF1, 0xF7, 0xF3, 0xF0, 0xF6, 0xF2, 0xF4, 0xF1, 0xED, 0xBD, 0x7E, 0x99, 0x44, 0x83,
-    0xD5, 0x8E, 0x69, 0x42, 0x18, 0x3B, 0x1B, 0x07, 0x0C, 0x08, 0x09, 0x08, 0x07, 0x08, 0x07, 0x05,
-    0x04, 0x04, 0x04, 0x07, 0x08, 0x08, 0x3D, 0x2C, 0x46, 0x6A, 0x42, 0x29, 0x63, 0xA9, 0xA2, 0x74,
-    0x8C, 0xA8, 0xAD, 0x7D, 0x62, 0x30, 0x4D, 0xA9, 0x6A, 0x20, 0x1F, 0x33, 0x25, 0x70, 0xCE, 0xFD,
-    0xF6, 0xFB, 0xF7, 0xF7, 0xF5, 0xF8, 0xF6, 0xF8, 0xF6, 0xFA, 0xFC, 0xF6, 0xFA, 0xFE, 0x9E, 0x94,
-    0x3C, 0x2E, 0x2A, 0x20, 0x1F, 0x2D, 0x24, 0x21, 0x39, 0xA9, 0xFB, 0xF7, 0xFC, 0xF7, 0xFA, 0xE7,
-    0xD7, 0xDC, 0xF5, 0xF9, 0xF3, 0xEA, 0xF1, 0xEA, 0xF8, 0xF4, 0xFB, 0xF1, 0xF7, 0xE6, 0x94, 0x42,
-    0xA6, 0x6C, 0x2A, 0x20, 0x24, 0x24, 0x19, 0x31, 0x21, 0x0F, 0x0B, 0x09, 0x09, 0x0C, 0x0B, 0x07,
-    0x08, 0x0A, 0x08, 0x05, 0x08, 0x08, 0x09, 0x08, 0x13, 0x1A, 0x25, 0x1F, 0x24, 0x2A, 0x43, 0x70,
-    0x76, 0x44, 0x61, 0x92, 0xB8, 0xBC, 0x98, 0x46, 0x46, 0x6E, 0x58, 0x20, 0x15, 0x21, 0x0F, 0x49,
-    0x7B, 0xDF, 0xF7, 0xEC, 0xF6, 0xFE, 0xFC, 0xFB, 0xFB, 0xF2, 0xFD, 0xE4, 0xE9, 0xF7, 0xE5, 0xBC,
-    0x8D, 0x8F, 0x1A, 0x25, 0x1C, 0x16, 0x11, 0x38, 0x20, 0x1C, 0x17, 0x6F, 0xFB, 0xF2, 0xF7, 0xF6,
-    0xFB, 0xF1, 0xE8, 0xBF, 0xAC, 0xCD, 0xBE, 0xF3, 0xE2, 0xF4, 0xE9, 0xCE, 0xA9, 0xB1, 0x99, 0xAA,
-    0x5D, 0x56, 0x47, 0x4D, 0x4D, 0x21, 0x1F, 0x24, 0x1A, 0x1E, 0x11, 0x04, 0x08, 0x07, 0x08, 0x07,
-    0x06, 0x06, 0x08, 0x05, 0x04, 0x04, 0x06, 0x09, 0x06, 0x04, 0x09, 0x08, 0x07, 0x0F, 0x13, 0x0C,
-    0x15, 0x24, 0x38, 0x36, 0x44, 0x65, 0x91, 0xA3, 0xB1, 0x6C, 0x28, 0x77, 0x38, 0x37, 0x1A, 0x10,
-    0x13, 0x52, 0x36, 0x4D, 0x67, 0x8C, 0x8C, 0x9B, 0xF0, 0xF3, 0xCB, 0x84, 0xB9, 0x91, 0x81, 0x82,
-    0x50, 0x6B, 0x1C, 0x58, 0x50, 0x31, 0x32, 0x19, 0x35, 0x5A, 0x21, 0x21, 0x24, 0x92, 0xF8, 0xF5,
-    0xF7, 0xF3, 0xF7, 0xF8, 0xCE, 0x9B, 0xA0, 0x9B, 0x20, 0x76, 0x66, 0x47, 0x4A, 0x7C, 0xA1, 0xCB,
-    0xB1, 0xD8, 0xB3, 0x9C, 0xB3, 0xDA, 0xD6, 0xB5, 0x8A, 0x5D, 0x4E, 0x46, 0x22, 0x0B, 0x0D, 0x0C,
-    0x0E, 0x0C, 0x0B, 0x09, 0x08, 0x06, 0x09, 0x06, 0x05, 0x09, 0x0A, 0x09, 0x07, 0x08, 0x0C, 0x0B,
-    0x05, 0x07, 0x09, 0x07, 0x04, 0x0A, 0x0C, 0x14, 0x21, 0x38, 0x40, 0x18, 0x50, 0x80, 0x3F, 0x27,
-    0x17, 0x09, 0x06, 0x1B, 0x33, 0x01, 0x00, 0x1D, 0x13, 0x09, 0x2A, 0x41, 0x1E, 0x0F, 0x0E, 0x11,
-    0x09, 0x02, 0x18, 0x14, 0x0D, 0x0B, 0x0E, 0x1C, 0x13, 0x0B, 0x3E, 0x31, 0x0F, 0x1C, 0x1D, 0x61,
-    0xAA, 0xFC, 0xF7, 0xF9, 0xFB, 0xF7, 0xF0, 0xEC, 0xB2, 0xD3, 0x87, 0x01, 0x14, 0x16, 0x3F, 0x57,
-    0xAA, 0xC6, 0xFA, 0xFC, 0x8A, 0xB5, 0xD4, 0xD5, 0xD4, 0xE5, 0x88, 0x5D, 0x63, 0x3A, 0x1C, 0x09,
-    0x0B, 0x0B, 0x0A, 0x08, 0x07, 0x05, 0x06, 0x07, 0x08, 0x07, 0x05, 0x07, 0x05, 0x07, 0x10, 0x0B,
-    0x0A, 0x08, 0x06, 0x08, 0x0A, 0x0B, 0x0A, 0x0A, 0x09, 0x04, 0x05, 0x07, 0x09, 0x11, 0x1B, 0x53,
-    0x27, 0x0B, 0x11, 0x10, 0x10, 0x10, 0x37, 0x28, 0x16, 0x00, 0x05, 0x0A, 0x07, 0x02, 0x13, 0x2F,
-    0x42, 0x34, 0x19, 0x56, 0x5C, 0x1A, 0x10, 0x11, 0x12, 0x1B, 0x1C, 0x0F, 0x6B, 0x55, 0x1F, 0x1E,
-    0x1D, 0x27, 0xA6, 0xFA, 0xF8, 0xF5, 0xF8, 0xF9, 0xE6, 0xE8, 0xCD, 0xCB, 0xC1, 0x3B, 0x20, 0x1C,
-    0x2D, 0x2D, 0x2F, 0x24, 0x5C, 0x8C, 0x60, 0x57, 0x74, 0x53, 0x76, 0x75, 0x5E, 0x4D, 0x58, 0x2A,
-    0x14, 0x08, 0x0C, 0x0B, 0x0A, 0x09, 0x09, 0x07, 0x07, 0x0C, 0x0B, 0x08, 0x09, 0x0A, 0x08, 0x05,
-    0x18, 0x14, 0x17, 0x1E, 0x13, 0x08, 0x04, 0x06, 0x06, 0x06, 0x05, 0x08, 0x0A, 0x0D, 0x0B, 0x0A,
-    0x05, 0x11, 0x0E, 0x0A, 0x0A, 0x0A, 0x10, 0x09, 0x17, 0x18, 0x11, 0x3B, 0x3B, 0x10, 0x0F, 0x0E,
-    0x1A, 0x1C, 0x45, 0x4D, 0x23, 0x25, 0x18, 0x1B, 0x16, 0x19, 0x16, 0x14, 0x1B, 0x0F, 0x8D, 0x75,
-    0x29, 0x2D, 0x28, 0x29, 0xA3, 0xFA, 0xF2, 0xF4, 0xF3, 0xF4, 0xF4, 0xE1, 0xF4, 0xE2, 0x69, 0x3E,
-    0x4F, 0x2A, 0x2E, 0x33, 0x14, 0x05, 0x01, 0x06, 0x15, 0x1E, 0x0F, 0x3F, 0x44, 0x4C, 0x3D, 0x64,
-    0x47, 0x23, 0x12, 0x0D, 0x0D, 0x0E, 0x06, 0x04, 0x07, 0x08, 0x07, 0x0A, 0x0C, 0x07, 0x07, 0x08,
-    0x08, 0x07, 0x1A, 0x2C, 0x30, 0x46, 0x58, 0x6D, 0x5F, 0x2E, 0x3A, 0x30, 0x20, 0x16, 0x0F, 0x0C,
-    0x0B, 0x11, 0x0E, 0x06, 0x09, 0x16, 0x16, 0x0F, 0x14, 0x10, 0x19, 0x1D, 0x27, 0x94, 0x6C, 0x09,
-    0x16, 0x11, 0x0E, 0x12, 0x2F, 0x2C, 0x37, 0x32, 0x17, 0x1B, 0x23, 0x1E, 0x29, 0x22, 0x2E, 0x37,
-    0x6E, 0x50, 0x33, 0x38, 0x49, 0x4B, 0x85, 0xFA, 0xF9, 0xF8, 0xF6, 0xF9, 0xFB, 0xF6, 0xEF, 0xE5,
-    0xAF, 0xD5, 0xA1, 0x2A, 0x1A, 0x15, 0x0B, 0x1B, 0x1F, 0x11, 0x0F, 0x32, 0x88, 0xC9, 0xBF, 0xD7,
-    0xAA, 0x86, 0x48, 0x2B, 0x1C, 0x13, 0x13, 0x0D, 0x31, 0x3E, 0x2E, 0x12, 0x28, 0x1E, 0x12, 0x17,
-    0x19, 0x18, 0x10, 0x11, 0x30, 0x2E, 0x22, 0x5C, 0x79, 0x93, 0x9C, 0x66, 0x71, 0x93, 0x93, 0x88,
-    0x56, 0x3B, 0x44, 0x52, 0x45, 0x40, 0x1F, 0x21, 0x13, 0x21, 0x21, 0x18, 0x10, 0x18, 0x25, 0x61,
-    0x3B, 0x0B, 0x14, 0x11, 0x16, 0x1E, 0x1A, 0x16, 0x15, 0x22, 0x17, 0x12, 0x2A, 0x5E, 0x72, 0x4D,
-    0x1C, 0x2D, 0x4E, 0x46, 0x35, 0x28, 0x33, 0x47, 0x5D, 0xCA, 0xFC, 0xED, 0xE8, 0xFB, 0xFD, 0xAE,
-    0x8D, 0xA8, 0xBE, 0xCD, 0x67, 0x5B, 0x55, 0x27, 0x6C, 0x85, 0x47, 0x38, 0x55, 0x7F, 0xF1, 0xEC,
-    0xE2, 0xD6, 0xE4, 0xE1, 0x9C, 0x54, 0x49, 0x38, 0x4E, 0x3A, 0x71, 0x3B, 0x3E, 0x2A, 0x3D, 0x24,
-    0x27, 0x32, 0x38, 0x2D, 0x11, 0x14, 0x30, 0x46, 0x3C, 0x35, 0x2D, 0x36, 0x30, 0x48, 0x75, 0x82,
-    0xAE, 0x7A, 0x19, 0x5D, 0x9E, 0x86, 0x95, 0x48, 0x17, 0x12, 0x0D, 0x16, 0x15, 0x0B, 0x0A, 0x06,
-    0x09, 0x05, 0x05, 0x07, 0x09, 0x08, 0x0A, 0x29, 0x11, 0x07, 0x0C, 0x16, 0x1B, 0x15, 0x13, 0x4F,
-    0x88, 0x7A, 0x0F, 0x13, 0x27, 0x27, 0x27, 0x0F, 0x10, 0x12, 0x17, 0x49, 0xE6, 0xF2, 0xED, 0xF9,
-    0xF4, 0xBB, 0xD4, 0x9A, 0x67, 0x82, 0x8F, 0x9E, 0x7E, 0x54, 0xC8, 0xC8, 0x5F, 0x75, 0xB8, 0xC4,
-    0xEE, 0xE2, 0xE2, 0xC3, 0xCA, 0xE8, 0xB4, 0xB0, 0x88, 0x6E, 0x56, 0x8F, 0xA8, 0x19, 0x33, 0x25,
-    0x3E, 0x32, 0x36, 0x23, 0x28, 0x29, 0x07, 0x0B, 0x2A, 0x49, 0x5B, 0x40, 0x1F, 0x1F, 0x26, 0x46,
-    0x51, 0x97, 0x7D, 0x10, 0x50, 0x6F, 0x62, 0x53, 0x5C, 0x2B, 0x35, 0x20, 0x10, 0x1E, 0x16, 0x0C,
-    0x17, 0x0C, 0x13, 0x1E, 0x11, 0x10, 0x0D, 0x0F, 0x1D, 0x12, 0x0F, 0x10, 0x09, 0x23, 0x1F, 0x0D,
-    0x15, 0x25, 0x2B, 0x33, 0x1A, 0x32, 0x42, 0x2F, 0x4B, 0x1B, 0x26, 0x21, 0x2F, 0xC8, 0xFA, 0xF8,
-    0xFB, 0xF8, 0xF6, 0xFB, 0xF9, 0xF3, 0xC7, 0xC2, 0xDD, 0x93, 0x90, 0xBC, 0xA4, 0xDE, 0xBE, 0xC2,
-    0xC8, 0xDF, 0xE7, 0xDB, 0xDF, 0xD8, 0xE0, 0xC9, 0xA4, 0xB8, 0xA7, 0x9A, 0x4F, 0x62, 0x99, 0x52,
-    0x31, 0x20, 0x59, 0x41, 0x24, 0x1C, 0x2C, 0x21, 0x11, 0x0E, 0x21, 0x1C, 0x28, 0x40, 0x22, 0x1D,
-    0x37, 0x3E, 0x15, 0x52, 0x2B, 0x66, 0x76, 0x37, 0x1E, 0x18, 0x26, 0x72, 0xB2, 0x2A, 0x1E, 0x22,
-    0x0F, 0x0B, 0x0E, 0x08, 0x0B, 0x18, 0x1B, 0x10, 0x09, 0x17, 0x15, 0x09, 0x0B, 0x08, 0x0A, 0x0A,
-    0x08, 0x0F, 0x0B, 0x0F, 0x1D, 0x3C, 0x12, 0x1D, 0x18, 0x35, 0x3A, 0x20, 0x24, 0x1C, 0x41, 0xD3,
-    0xFD, 0xF9, 0xF8, 0xFB, 0xF8, 0xEF, 0xF2, 0xEA, 0xE4, 0xA2, 0xC6, 0xC7, 0xBC, 0xD6, 0xC8, 0xE3,
-    0xD1, 0xE3, 0xEC, 0xE6, 0xDA, 0xD1, 0xD9, 0xE9, 0xE9, 0xB6, 0x9C, 0x9C, 0x59, 0x43, 0x52, 0xA7,
-    0x63, 0x65, 0x49, 0x12, 0x42, 0x3B, 0x1B, 0x18, 0x2C, 0x14, 0x09, 0x09, 0x23, 0x1E, 0x23, 0x1E,
-    0x15, 0x12, 0x24, 0x16, 0x1E, 0x32, 0x3A, 0x74, 0x3D, 0x3D, 0x1F, 0x10, 0x11, 0x62, 0xC0, 0x21,
-    0x1D, 0x1E, 0x0F, 0x12, 0x16, 0x09, 0x0D, 0x11, 0x23, 0x13, 0x0A, 0x08, 0x1B, 0x14, 0x0B, 0x0A,
-    0x0B, 0x09, 0x11, 0x21, 0x03, 0x41, 0x60, 0x0C, 0x18, 0x21, 0x1E, 0x6C, 0x42, 0x1F, 0x22, 0x20,
-    0x32, 0xC9, 0xFE, 0xF9, 0xF5, 0xF7, 0xF9, 0xF2, 0xF2, 0xE6, 0xDA, 0xE6, 0xEC, 0xED, 0xC5, 0xD9,
-    0xD7, 0xA6, 0xDF, 0xE1, 0xE5, 0xDF, 0xC8, 0xC4, 0xBA, 0xD9, 0xF1, 0xD9, 0xAC, 0xAE, 0x76, 0x2A,
-    0x7B, 0xBC, 0x7B, 0x32, 0x5D, 0x38, 0x26, 0x27, 0x20, 0x12, 0x2A, 0x15, 0x09, 0x0D, 0x1B, 0x1D,
-    0x1C, 0x10, 0x11, 0x13, 0x26, 0x27, 0x26, 0x2A, 0x54, 0x4A, 0x3E, 0x52, 0x3E, 0x3F, 0x57, 0x42,
-    0x64, 0x1E, 0x18, 0x29, 0x1D, 0x0F, 0x10, 0x0B, 0x0E, 0x14, 0x52, 0x19, 0x0F, 0x0B, 0x33, 0x17,
-    0x0A, 0x10, 0x13, 0x0E, 0x14, 0x15, 0x09, 0x51, 0x57, 0x10, 0x16, 0x1C, 0x1B, 0x76, 0x4E, 0x16,
-    0x23, 0x28, 0x2E, 0xAA, 0xFC, 0xFB, 0xF5, 0xF2, 0xFA, 0xF6, 0xF3, 0xEE, 0xCD, 0xC1, 0xF1, 0xD4,
-    0xEB, 0xF0, 0xD8, 0x87, 0xDC, 0xE9, 0xDD, 0xE8, 0xE2, 0xDE, 0xD2, 0xCE, 0xC3, 0xB9, 0xBC, 0xDF,
-    0xCD, 0x7E, 0x96, 0xB4, 0xA4, 0x6D, 0x78, 0x42, 0x4A, 0x35, 0x3A, 0x27, 0x2A, 0x22, 0x13, 0x11,
-    0x17, 0x14, 0x0E, 0x0E, 0x15, 0x1A, 0x23, 0x2C, 0x35, 0x1E, 0x76, 0x39, 0x1B, 0x41, 0x43, 0x35,
-    0x3A, 0x01, 0x00, 0x00, 0x10, 0x23, 0x20, 0x04, 0x04, 0x06, 0x07, 0x0D, 0x2D, 0x0B, 0x0B, 0x04,
-    0x35, 0x33, 0x01, 0x0A, 0x08, 0x08, 0x09, 0x1C, 0x18, 0x1C, 0x0F, 0x09, 0x07, 0x40, 0x3F, 0x68,
-    0x40, 0x08, 0x14, 0x15, 0x0F, 0x84, 0xFF, 0xF8, 0xFA, 0xF5, 0xF1, 0xF3, 0xF7, 0xFA, 0xE2, 0xCB,
-    0xF5, 0xE9, 0xE6, 0xE5, 0xE2, 0xB4, 0xBF, 0xC7, 0xD5, 0xE3, 0xDB, 0xBC, 0xA3, 0x90, 0x3C, 0x1E,
-    0x17, 0x40, 0x4A, 0x3C, 0x44, 0x4F, 0x24, 0x4B, 0x37, 0x1F, 0x2D, 0x1A, 0x19, 0x1F, 0x15, 0x14,
-    0x0F, 0x0B, 0x25, 0x22, 0x2D, 0x2B, 0x43, 0x46, 0x50, 0x77, 0x62, 0x59, 0xA0, 0x81, 0xA4, 0xCA,
-    0xA1, 0xA4, 0xB8, 0xA2, 0x8D, 0x89, 0x93, 0x9A, 0x5E, 0x2F, 0x20, 0x1C, 0x1B, 0x19, 0x0F, 0x12,
-    0x10, 0x1B, 0x28, 0x20, 0x09, 0x0A, 0x11, 0x13, 0x24, 0x29, 0x13, 0x28, 0x2A, 0x10, 0x1B, 0x7A,
-    0x93, 0x57, 0x1A, 0x1E, 0x16, 0x20, 0x1F, 0x67, 0xEA, 0xF6, 0xFA, 0xFD, 0xF5, 0xEE, 0xF6, 0xE5,
-    0xD2, 0xD7, 0xEF, 0xF4, 0xCD, 0xE6, 0xE5, 0xE6, 0xE5, 0xDD, 0xE6, 0xDA, 0xD4, 0xCC, 0xB7, 0x71,
-    0x40, 0x30, 0x20, 0x3F, 0x4A, 0x34, 0x2D, 0x2D, 0x40, 0x45, 0x1E, 0x1F, 0x1F, 0x1E, 0x15, 0x08,
-    0x0B, 0x0C, 0x0D, 0x10, 0x14, 0x13, 0x16, 0x31, 0x28, 0x23, 0x31, 0x33, 0x36, 0x61, 0x46, 0x6E,
-    0xDC, 0xD0, 0x58, 0xA0, 0xDB, 0xE4, 0xE6, 0xED, 0xEB, 0x92, 0x36, 0x38, 0x39, 0x20, 0x2A, 0x25,
-    0x2D, 0x16, 0x0F, 0x12, 0x22, 0x17, 0x06, 0x05, 0x0E, 0x12, 0x16, 0x14, 0x08, 0x44, 0x19, 0x04,
-    0x2B, 0x47, 0x67, 0x36, 0x1D, 0x12, 0x0C, 0x11, 0x11, 0x2A, 0xE1, 0xFB, 0xFB, 0xD7, 0xC9, 0xFA,
-    0xDD, 0xC4, 0xC9, 0xE6, 0xF8, 0xEA, 0xE3, 0xE7, 0xE8, 0xEE, 0xEC, 0xE0, 0xD9, 0xC5, 0xC1, 0xC5,
-    0xBA, 0x95, 0x66, 0x82, 0x8A, 0x1C, 0x2D, 0x17, 0x33, 0x2C, 0x2D, 0x28, 0x1B, 0x15, 0x0A, 0x17,
-    0x11, 0x0C, 0x08, 0x0B, 0x0D, 0x09, 0x15, 0x0F, 0x1E, 0x49, 0x32, 0x2C, 0x58, 0x58, 0x2A, 0x50,
-    0x78, 0x65, 0xBC, 0x90, 0x32, 0x78, 0x9C, 0xA0, 0xB0, 0xF3, 0xEE, 0xA7, 0x3C, 0x58, 0x1C, 0x4A,
-    0x5A, 0x1F, 0x2C, 0x3B, 0x17, 0x11, 0x20, 0x24, 0x0C, 0x0F, 0x1D, 0x22, 0x15, 0x12, 0x10, 0x27,
-    0x1D, 0x05, 0x4E, 0x60, 0x5D, 0x3A, 0x13, 0x12, 0x17, 0x1B, 0x10, 0x61, 0xF5, 0xF9, 0xED, 0xB7,
-    0xE4, 0xFB, 0x84, 0x82, 0xE9, 0xBA, 0x98, 0xE4, 0xEE, 0xE2, 0xE3, 0xE5, 0xE3, 0xED, 0xA6, 0xC3,
-    0xDD, 0xD4, 0xB1, 0xA2, 0x4B, 0xA4, 0xB1, 0x29, 0x0E, 0x13, 0x2A, 0x39, 0x56, 0x35, 0x2E, 0x17,
-    0x16, 0x28, 0x18, 0x14, 0x21, 0x15, 0x11, 0x13, 0x0C, 0x0D, 0x1C, 0x32, 0x20, 0x2A, 0x48, 0x52,
-    0x34, 0x23, 0x4F, 0x81, 0x89, 0x5F, 0x8E, 0xAC, 0x96, 0x9A, 0x9A, 0xE6, 0xDF, 0xD1, 0x7F, 0xC3,
-    0x4B, 0x24, 0x2B, 0x29, 0x30, 0x16, 0x0C, 0x13, 0x1B, 0x15, 0x0E, 0x00, 0x13, 0x2E, 0x0B, 0x0B,
-    0x12, 0x10, 0x15, 0x0E, 0x64, 0x4B, 0x2C, 0x2A, 0x0D, 0x10, 0x10, 0x11, 0x12, 0x1E, 0x93, 0xE9,
-    0xEE, 0xF6, 0xF7, 0xF9, 0xD8, 0xC0, 0xF0, 0xD6, 0xBD, 0xDC, 0xD2, 0xE3, 0xD6, 0xDD, 0xE2, 0xF2,
-    0xBC, 0xAB, 0xD3, 0xBD, 0xA1, 0x66, 0x66, 0x4D, 0x41, 0x3B, 0x41, 0x2F, 0x3A, 0x59, 0x33, 0x29,
-    0x6B, 0x2F, 0x21, 0x32, 0x18, 0x0E, 0x1E, 0x15, 0x19, 0x1F, 0x17, 0x12, 0x20, 0x3C, 0x27, 0x3C,
-    0x34, 0x6E, 0x37, 0x3C, 0x25, 0x9A, 0x92, 0x4D, 0x9A, 0xAE, 0xC0, 0xAD, 0xAF, 0xE5, 0xCB, 0xE6,
-    0x8A, 0x97, 0x82, 0x15, 0x15, 0x3D, 0x22, 0x22, 0x2D, 0x1A, 0x7F, 0x75, 0x15, 0x64, 0x2E, 0x4D,
-    0x16, 0x14, 0x0F, 0x16, 0x04, 0x14, 0x20, 0x22, 0x08, 0x0E, 0x0C, 0x0C, 0x0A, 0x0F, 0x13, 0x0B,
-    0x90, 0xFF, 0xFD, 0xF3, 0xF0, 0xF2, 0xFA, 0xF0, 0xF6, 0xE1, 0xBA, 0xE5, 0xDF, 0xEA, 0xDC, 0xD1,
-    0xE5, 0xF6, 0xE0, 0xD4, 0xC2, 0xA6, 0xAB, 0x81, 0x4B, 0x18, 0x24, 0x5B, 0x80, 0xA3, 0x7B, 0x09,
-    0x22, 0x9C, 0x80, 0x7D, 0x50, 0x2C, 0x20, 0x17, 0x22, 0x2C, 0x21, 0x22, 0x26, 0x15, 0x20, 0x40,
-    0x41, 0x3D, 0x2A, 0x71, 0x3F, 0x67, 0x39, 0x69, 0x74, 0x67, 0x6A, 0x5B, 0x7F, 0x80, 0xE4, 0xEC,
-    0xC2, 0xE2, 0x86, 0x88, 0xA4, 0x36, 0x21, 0x36, 0x39, 0x3C, 0x2A, 0x13, 0x5F, 0x4A, 0x60, 0x9A,
-    0x98, 0x66, 0x25, 0x57, 0x0C, 0x24, 0x45, 0x19, 0x22, 0x14, 0x14, 0x0E, 0x0D, 0x0C, 0x0F, 0x11,
-    0x13, 0x11, 0x3D, 0xD0, 0xF2, 0xEE, 0xF1, 0xF1, 0xF4, 0xEC, 0xD4, 0xE5, 0xED, 0xE8, 0xEE, 0xF0,
-    0xE5, 0xE1, 0xE7, 0xE6, 0xE1, 0xCF, 0xB3, 0xB5, 0xA0, 0x72, 0x3F, 0x41, 0x37, 0x58, 0x5D, 0x60,
-    0x48, 0x3E, 0x68, 0x8D, 0x7D, 0x5F, 0x37, 0x47, 0x52, 0x3E, 0x34, 0x1D, 0x18, 0x13, 0x1B, 0x0B,
-    0x17, 0x1C, 0x31, 0x17, 0x0F, 0x14, 0x0B, 0x2D, 0x1A, 0x19, 0x08, 0x0F, 0x12, 0x0D, 0x09, 0x0C,
-    0x3B, 0xA9, 0x8E, 0xB4, 0x9F, 0x6F, 0x77, 0x44, 0x09, 0x1B, 0x2F, 0x14, 0x12, 0x13, 0x2B, 0x2E,
-    0xBB, 0x94, 0x72, 0x69, 0x75, 0x58, 0x14, 0x1C, 0x70, 0x6B, 0x1D, 0x0A, 0x0A, 0x0A, 0x08, 0x08,
-    0x0A, 0x0B, 0x09, 0x0B, 0x10, 0x66, 0xEF, 0xF7, 0xF4, 0xF2, 0xEE, 0xE7, 0xDE, 0xE4, 0xEE, 0xDC,
-    0xE8, 0xF5, 0xF0, 0xF1, 0xF2, 0xDD, 0xDF, 0xC8, 0xA2, 0x9D, 0x43, 0x25, 0x44, 0x26, 0x0C, 0x13,
-    0x03, 0x05, 0x05, 0x10, 0x11, 0x14, 0x21, 0x30, 0x17, 0x2E, 0x34, 0x2B, 0x28, 0x0C, 0x13, 0x0D,
-    0x0C, 0x0D, 0x0C, 0x06, 0x0B, 0x0B, 0x07, 0x08, 0x09, 0x0C, 0x0A, 0x0C, 0x0D, 0x0C, 0x09, 0x0E,
-    0x11, 0x13, 0x08, 0x19, 0x43, 0x9B, 0xE3, 0x6A, 0x61, 0x76, 0x1B, 0x2C, 0x24, 0x26, 0x16, 0x29,
-    0x34, 0x4E, 0xA0, 0x4B, 0x52, 0x3F, 0x5D, 0x7B, 0x37, 0x2A, 0x60, 0x5E, 0x13, 0x15, 0x13, 0x0E,
-    0x0E, 0x11, 0x12, 0x13, 0x18, 0x14, 0x1D, 0x4F, 0xE8, 0xF8, 0xEB, 0xF6, 0xF2, 0xF6, 0xEF, 0xF1,
-    0xEF, 0xF9, 0xDB, 0xE0, 0xF5, 0xF0, 0xF1, 0xF5, 0xD4, 0xEE, 0xAE, 0x7E, 0x6E, 0x1F, 0x23, 0x06,
-    0x09, 0x0D, 0x0E, 0x0E, 0x0D, 0x0A, 0x08, 0x08, 0x09, 0x05, 0x09, 0x0C, 0x0B, 0x0F, 0x19, 0x12,
-    0x18, 0x0F, 0x0B, 0x0B, 0x07, 0x07, 0x08, 0x06, 0x08, 0x07, 0x06, 0x09, 0x08, 0x07, 0x09, 0x06,
-    0x04, 0x0A, 0x07, 0x09, 0x0D, 0x12, 0x2B, 0x83, 0xB9, 0xB3, 0x64, 0x68, 0x3A, 0x1E, 0x16, 0x11,
-    0x09, 0x20, 0x2A, 0x14, 0x15, 0x07, 0x02, 0x1E, 0x1C, 0x41, 0x6C, 0x1B, 0x46, 0x57, 0x28, 0x01,
-    0x0E, 0x0A, 0x05, 0x07, 0x06, 0x02, 0x01, 0x13, 0x2C, 0x80, 0xED, 0xF1, 0xED, 0xF4, 0xF3, 0xF8,
-    0xF6, 0xEC, 0xEA, 0xE7, 0xE5, 0xE2, 0xF1, 0xEA, 0xCB, 0xC9, 0xE8, 0xD3, 0x6C, 0x7C, 0x62, 0x59,
-    0x32, 0x23, 0x46, 0x06, 0x08, 0x0A, 0x08, 0x08, 0x07, 0x06, 0x08, 0x06, 0x05, 0x07, 0x07, 0x02,
-    0x05, 0x06, 0x06, 0x07, 0x0C, 0x09, 0x09, 0x09, 0x09, 0x0C, 0x07, 0x09, 0x08, 0x06, 0x09, 0x06,
-    0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x10, 0x0A, 0x23, 0xDA, 0xFB, 0xC5, 0xCB, 0x90, 0x74, 0x4D, 0x72,
-    0x29, 0x12, 0x17, 0x44, 0x1A, 0x0B, 0x0F, 0x19, 0x1D, 0x14, 0x1E, 0x51, 0x40, 0x11, 0x32, 0x44,
-    0x72, 0x91, 0x4F, 0x99, 0x8F, 0x5F, 0x52, 0x66, 0x52, 0x80, 0xBA, 0xF4, 0xF8, 0xFC, 0xF9, 0xF0,
-    0xF1, 0xF7, 0xF7, 0xEE, 0xEF, 0xE6, 0xFC, 0xF0, 0xE7, 0xE4, 0xD3, 0xBA, 0xBF, 0xAD, 0x9E, 0x8C,
-    0x95, 0x62, 0x8B, 0x8D, 0xA0, 0x5D, 0x37, 0x2B, 0x1B, 0x0B, 0x0E, 0x0B, 0x07, 0x05, 0x09, 0x07,
-    0x06, 0x08, 0x06, 0x04, 0x07, 0x08, 0x0A, 0x08, 0x06, 0x07, 0x0A, 0x07, 0x06, 0x0A, 0x07, 0x09,
-    0x0A, 0x07, 0x07, 0x09, 0x09, 0x0A, 0x0E, 0x0D, 0x10, 0x20, 0xA0, 0xDB, 0xFD, 0xE8, 0x64, 0x73,
-    0xCF, 0x66, 0x55, 0x14, 0x25, 0x30, 0x0F, 0x0C, 0x10, 0x1B, 0x1B, 0x53, 0x47, 0x53, 0x52, 0x26,
-    0x50, 0x47, 0xAC, 0xE2, 0xEE, 0xFB, 0xFD, 0xED, 0xD5, 0xFA, 0xF3, 0xE5, 0xED, 0xF7, 0xF8, 0xF5,
-    0xFA, 0xFA, 0xEE, 0xED, 0xF4, 0xEA, 0xD3, 0xD9, 0xE8, 0xF2, 0xD0, 0xE3, 0xE2, 0xCE, 0x80, 0x42,
-    0x86, 0xB8, 0x57, 0x3D, 0xA7, 0x67, 0x6B, 0x59, 0x1D, 0x62, 0x69, 0x4F, 0x30, 0x22, 0x1B, 0x29,
-    0x13, 0x05, 0x08, 0x08, 0x06, 0x09, 0x05, 0x07, 0x08, 0x07, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08,
-    0x0A, 0x06, 0x07, 0x06, 0x04, 0x04, 0x05, 0x07, 0x06, 0x0B, 0x0C, 0x0D, 0x17, 0x6D, 0xC1, 0x85,
-    0x54, 0x81, 0xC7, 0x54, 0x99, 0x2E, 0x35, 0x12, 0x17, 0x18, 0x58, 0x5E, 0x31, 0x56, 0x46, 0x6E,
-    0x69, 0x20, 0x4E, 0x51, 0x90, 0x98, 0xD3, 0xCB, 0xE5, 0xEF, 0xEC, 0x97, 0x8E, 0xE9, 0xED, 0xF2,
-    0xEF, 0xF3, 0xF7, 0xF4, 0xE9, 0xF6, 0xF7, 0xE7, 0xC7, 0xD6, 0xE4, 0xF4, 0xDE, 0xE4, 0xEA, 0xD2,
-    0xA6, 0x74, 0x61, 0x80, 0x3A, 0xA2, 0xAF, 0xA1, 0x65, 0x39, 0x32, 0xAB, 0xAB, 0xA1, 0x7E, 0x72,
-    0x36, 0x4E, 0x42, 0x28, 0x23, 0x10, 0x0A, 0x0A, 0x0B, 0x08, 0x09, 0x06, 0x0B, 0x08, 0x07, 0x0A,
-    0x0A, 0x08, 0x09, 0x07, 0x07, 0x05, 0x06, 0x07, 0x08, 0x07, 0x08, 0x0C, 0x0A, 0x0A, 0x0D, 0x09,
-    0x2A, 0x78, 0x66, 0x38, 0x91, 0x3D, 0x77, 0x57, 0x30, 0x1F, 0x26, 0x0E, 0x42, 0xCA, 0x55, 0x4F,
-    0x67, 0x43, 0x32, 0x2D, 0x56, 0x34, 0x73, 0xA9, 0x87, 0x75, 0x70, 0xC3, 0xCE, 0xAC, 0xBE, 0xF9,
-    0xFB, 0xF7, 0xF5, 0xF8, 0xF6, 0xED, 0xEA, 0xFA, 0xF3, 0xEE, 0xE2, 0xED, 0xED, 0xEC, 0xC4, 0xE4,
-    0xEA, 0xE0, 0xCC, 0xBC, 0x96, 0x93, 0x5F, 0x73, 0x57, 0x9E, 0x75, 0x55, 0x1D, 0x35, 0x52, 0x8F,
-    0x90, 0x56, 0x3D, 0x69, 0x54, 0x3F, 0x21, 0x13, 0x24, 0x24, 0x1B, 0x15, 0x07, 0x08, 0x0A, 0x09,
-    0x08, 0x07, 0x07, 0x06, 0x04, 0x07, 0x06, 0x05, 0x04, 0x05, 0x06, 0x06, 0x09, 0x02, 0x02, 0x0C,
-    0x1A, 0x12, 0x0F, 0x2C, 0x76, 0x2D, 0x40, 0x22, 0x3A, 0x6F, 0x02, 0x61, 0x78, 0x08, 0x4C, 0x95,
-    0x1D, 0x1A, 0x21, 0x11, 0x17, 0x18, 0x20, 0x18, 0x37, 0x27, 0x40, 0x38, 0x24, 0x41, 0x73, 0xE9,
-    0xF2, 0xD6, 0xC0, 0xD9, 0xF1, 0xE5, 0xDF, 0xE9, 0xDF, 0xE2, 0xEB, 0xEC, 0xF5, 0xF2, 0xF5, 0xDC,
-    0xB7, 0xD8, 0xE2, 0xDD, 0xCF, 0xCD, 0xEA, 0xD8, 0x46, 0x04, 0x08, 0x8B, 0x85, 0x53, 0x30, 0x6B,
-    0x5C, 0x6B, 0x77, 0x58, 0x32, 0x52, 0x47, 0x1D, 0x0B, 0x1A, 0x30, 0x1D, 0x10, 0x12, 0x07, 0x0A,
-    0x09, 0x09, 0x07, 0x07, 0x07, 0x08, 0x09, 0x0E, 0x0B, 0x09, 0x0A, 0x0C, 0x0B, 0x0F, 0x09, 0x35,
-    0x60, 0x8B, 0x8A, 0x55, 0x51, 0x63, 0x9F, 0x46, 0x74, 0x6C, 0x6C, 0x62, 0x0F, 0x47, 0x32, 0x22,
-    0x1B, 0x2E, 0x13, 0x1C, 0x26, 0x22, 0x1D, 0x16, 0x45, 0x1F, 0x0B, 0x11, 0x14, 0x19, 0x19, 0x23,
-    0x31, 0x7C, 0x98, 0xCD, 0xAD, 0xBE, 0xF0, 0xD4, 0xCC, 0xDD, 0xBE, 0xDA, 0xED, 0xE8, 0xE5, 0xE5,
-    0xEE, 0xF3, 0xE4, 0xE1, 0xE7, 0xDB, 0xDF, 0xEB, 0xE4, 0xB8, 0x56, 0x2F, 0x20, 0x71, 0x5E, 0x4C,
-    0x58, 0x8E, 0x4F, 0x62, 0x60, 0x58, 0x3F, 0x45, 0x40, 0x15, 0x27, 0x28, 0x1C, 0x12, 0x15, 0x12,
-    0x0A, 0x06, 0x08, 0x07, 0x06, 0x08, 0x06, 0x06, 0x07, 0x0A, 0x05, 0x05, 0x0A, 0x08, 0x21, 0x35,
-    0x3C, 0x54, 0x84, 0x92, 0x8D, 0x81, 0x91, 0xAE, 0xE0, 0x76, 0xC0, 0xB8, 0xA6, 0xAA, 0x38, 0x12,
-    0x11, 0x07, 0x11, 0x13, 0x0C, 0x08, 0x08, 0x10, 0x0C, 0x09, 0x2A, 0x19, 0x23, 0x0D, 0x08, 0x01,
-    0x05, 0x05, 0x09, 0x37, 0x60, 0xBF, 0xFE, 0xA2, 0x78, 0x99, 0xC6, 0x69, 0xDF, 0xE3, 0xC2, 0xE5,
-    0xD7, 0xD5, 0xB8, 0xD7, 0xF6, 0xE5, 0xE0, 0xDD, 0xE4, 0xCF, 0xD4, 0xB2, 0xA9, 0x91, 0x87, 0x81,
-    0x57, 0x9D, 0x6F, 0x61, 0x2C, 0x41, 0x37, 0x53, 0x47, 0x2A, 0x22, 0x20, 0x18, 0x0B, 0x15, 0x1E,
-    0x12, 0x0D, 0x09, 0x09, 0x09, 0x08, 0x06, 0x09, 0x0B, 0x09, 0x07, 0x06, 0x0A, 0x21, 0x1A, 0x21,
-    0x40, 0x37, 0x66, 0x3C, 0x61, 0x86, 0x78, 0x84, 0xB2, 0xB0, 0xF8, 0x7A, 0xC0, 0xD0, 0xA6, 0xA3,
-    0xA5, 0x39, 0x0D, 0x12, 0x0E, 0x10, 0x0B, 0x0C, 0x0B, 0x0B, 0x0C, 0x0A, 0x08, 0x0A, 0x35, 0x25,
-    0x0B, 0x2A, 0x28, 0x54, 0x3B, 0x0A, 0x3D, 0x66, 0x81, 0x7E, 0x42, 0x65, 0xC5, 0x85, 0xEE, 0xEC,
-    0xC1, 0xE9, 0xD6, 0xAA, 0xAB, 0xCE, 0xF0, 0xEC, 0xD7, 0xD4, 0xDD, 0xD7, 0xC3, 0xC6, 0xCA, 0xD6,
-    0xA9, 0xAD, 0xA3, 0xAC, 0x8F, 0x74, 0x2B, 0x1E, 0x11, 0x2D, 0x2F, 0x28, 0x1F, 0x24, 0x1F, 0x17,
-    0x21, 0x21, 0x11, 0x0A, 0x0A, 0x0B, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x07, 0x12, 0x28, 0x14, 0x3F,
-    0x62, 0x5E, 0x96, 0x38, 0x85, 0x8E, 0x62, 0xAE, 0x9C, 0x67, 0xA7, 0xA8, 0xD4, 0xA8, 0x84, 0x7F,
-    0x8A, 0x34, 0x43, 0x60, 0x16, 0x0F, 0x10, 0x0F, 0x2B, 0x13, 0x0F, 0x11, 0x0C, 0x0C, 0x09, 0x0B,
-    0x08, 0x0D, 0x0F, 0x28, 0x19, 0x2E, 0x20, 0x44, 0x6C, 0x7F, 0x89, 0xBF, 0xE7, 0xEB, 0xDC, 0xF2,
-    0xDB, 0xDB, 0xD5, 0xD8, 0xD5, 0xA5, 0xBD, 0xE7, 0xDA, 0xE4, 0xE2, 0xD2, 0xDA, 0xCF, 0xB5, 0x73,
-    0x6E, 0x85, 0x82, 0xC7, 0xC3, 0xB3, 0x79, 0x5F, 0x39, 0x04, 0x20, 0x23, 0x1A, 0x17, 0x19, 0x15,
-    0x14, 0x1B, 0x17, 0x15, 0x0F, 0x0B, 0x0B, 0x08, 0x09, 0x07, 0x08, 0x0A, 0x10, 0x1D, 0x27, 0x36,
-    0x2D, 0x19, 0x36, 0x58, 0x49, 0x4E, 0xA2, 0x84, 0x29, 0x6C, 0x59, 0x7F, 0xA1, 0xC2, 0x9D, 0xC4,
-    0x4E, 0xA8, 0x59, 0x61, 0x91, 0x9C, 0x2C, 0x1B, 0x00, 0x3F, 0x50, 0x01, 0x09, 0x02, 0x03, 0x02,
-    0x07, 0x06, 0x09, 0x0D, 0x0B, 0x11, 0x26, 0x4D, 0x64, 0x86, 0xAB, 0xB8, 0xE6, 0xE5, 0xE8, 0xEB,
-    0xE2, 0xD8, 0xE1, 0xE5, 0xD7, 0xE1, 0xE7, 0xCF, 0xDC, 0xD8, 0xDB, 0xE7, 0xD2, 0xD4, 0xD3, 0xC0,
-    0xAA, 0x4A, 0x0F, 0x39, 0x24, 0x83, 0xB3, 0xC5, 0xCE, 0x94, 0x61, 0x4C, 0x43, 0x5D, 0x34, 0x2E,
-    0x1C, 0x0B, 0x12, 0x09, 0x05, 0x0C, 0x0B, 0x0A, 0x0D, 0x0D, 0x13, 0x0D, 0x10, 0x23, 0x1C, 0x53,
-    0x4F, 0x37, 0x3D, 0x1C, 0x26, 0x7E, 0x45, 0x3F, 0x91, 0x7F, 0x0D, 0x1F, 0x37, 0x77, 0xB8, 0x9C,
-    0xC6, 0xDC, 0x7A, 0x51, 0x5E, 0x83, 0x68, 0xA4, 0x71, 0x1A, 0x4F, 0x6C, 0x53, 0x86, 0x4F, 0x40,
-    0x36, 0x2E, 0x0F, 0x1E, 0x0F, 0x0B, 0x0C, 0x26, 0x92, 0x74, 0xC1, 0xE3, 0xF2, 0xE9, 0xE4, 0xE6,
-    0xDF, 0xF1, 0xE5, 0xDA, 0xF1, 0xEF, 0xDF, 0xE7, 0xE3, 0xD8, 0xDC, 0xDB, 0xD7, 0xD6, 0xD4, 0xD8,
-    0xD5, 0xC5, 0xBA, 0x87, 0x5E, 0x50, 0x15, 0x10, 0x1C, 0x48, 0x77, 0x67, 0x83, 0x79, 0x2D, 0x39,
-    0x42, 0x3E, 0x28, 0x1A, 0x19, 0x0F, 0x09, 0x0D, 0x07, 0x08, 0x11, 0x0E, 0x10, 0x09, 0x07, 0x19,
-    0x1D, 0x2F, 0x52, 0x3C, 0x27, 0x1C, 0x08, 0x4E, 0x5A, 0x09, 0x36, 0x64, 0x31, 0x07, 0x41, 0x2A,
-    0x8A, 0xA9, 0xCB, 0xD9, 0xAB, 0x0C, 0x35, 0x46, 0x00, 0x64, 0xA2, 0x14, 0x3A, 0xAF, 0x9C, 0xD0,
-    0xD7, 0xCB, 0xA5, 0xC4, 0xB0, 0x92, 0x98, 0xA7, 0x94, 0xAB, 0xD9, 0xDE, 0xDF, 0xE2, 0xEA, 0xEE,
-    0xE0, 0xD1, 0xDA, 0xE4, 0xD3, 0xE9, 0xE2, 0xCF, 0xD4, 0xD8, 0xB6, 0x93, 0xAC, 0x9C, 0xCB, 0xDC,
-    0xCC, 0xC8, 0xC1, 0xBB, 0x85, 0x86, 0x69, 0x6D, 0x4E, 0x35, 0x1F, 0x40, 0x11, 0x34, 0x37, 0x22,
-    0x0C, 0x1A, 0x18, 0x32, 0x2D, 0x15, 0x12, 0x12, 0x11, 0x08, 0x08, 0x07, 0x10, 0x0E, 0x0C, 0x0D,
-    0x10, 0x11, 0x25, 0x4A, 0x66, 0x58, 0x36, 0x1D, 0x1B, 0x0F, 0x1F, 0x2F, 0x28, 0x5E, 0x8D, 0x4A,
-    0x54, 0x7F, 0x9D, 0xC4, 0xC8, 0xBB, 0x79, 0x76, 0x35, 0x32, 0x2D, 0x60, 0xD2, 0xA6, 0xA6, 0xDA,
-    0xCE, 0xEA, 0xED, 0xED, 0xE2, 0xF0, 0xF4, 0xEE, 0xF3, 0xEB, 0xF0, 0xF2, 0xEA, 0xED, 0xE3, 0xE7,
-    0xF0, 0xE0, 0xE1, 0xE5, 0xD9, 0xD8, 0xE0, 0xE4, 0xC8, 0xD1, 0xD3, 0xDA, 0xCE, 0xB3, 0xB2, 0xAC,
-    0xD0, 0xDF, 0xD1, 0xC2, 0x9E, 0x93, 0x8E, 0x7F, 0x4D, 0x5C, 0x38, 0x55, 0x6B, 0x3D, 0x26, 0x2C,
-    0x14, 0x2B, 0x13, 0x10, 0x18, 0x21, 0x1D, 0x24, 0x1D, 0x1D, 0x16, 0x11, 0x15, 0x14, 0x1A, 0x11,
-    0x14, 0x13, 0x10, 0x0A, 0x1D, 0x31, 0x2B, 0x21, 0x14, 0x1F, 0x12, 0x10, 0x0C, 0x50, 0x31, 0x1F,
-    0x76, 0x7A, 0x8C, 0x74, 0x75, 0x7A, 0x49, 0x68, 0x5B, 0xD2, 0x89, 0x72, 0x76, 0xB9, 0xDC, 0x87,
-    0x86, 0xC9, 0xAC, 0xE7, 0xDE, 0xE1, 0xEA, 0xE3, 0xDE, 0xE6, 0xDD, 0xD2, 0xEC, 0xD8, 0xE2, 0xE9,
-    0xD6, 0xC9, 0xD7, 0xE1, 0xCE, 0xE7, 0xD9, 0xB0, 0xD8, 0xE0, 0xD3, 0xE2, 0xD6, 0xD4, 0xE7, 0xD2,
-    0xB4, 0xCD, 0xCB, 0xDA, 0xCA, 0xB8, 0xA1, 0x81, 0x75, 0x51, 0x1D, 0x38, 0x0A, 0x36, 0x41, 0x1A,
-    0x1A, 0x0B, 0x11, 0x28, 0x12, 0x0E, 0x09, 0x0F, 0x1F, 0x20, 0x15, 0x10, 0x10, 0x18, 0x19, 0x12,
-    0x1E, 0x1D, 0x16, 0x13, 0x08, 0x0B, 0x0B, 0x09, 0x11, 0x1C, 0x0D, 0x0B, 0x25, 0x16, 0x29, 0x27,
-    0x2F, 0x50, 0x21, 0x10, 0x1A, 0x08, 0x2D, 0x8A, 0x3F, 0x5A, 0x5C, 0xB4, 0x65, 0x75, 0xB1, 0xCF,
-    0xDD, 0x7F, 0x3C, 0xB5, 0x63, 0x72, 0xA0, 0xD4, 0xDB, 0xD1, 0xE0, 0xE3, 0xDC, 0xD9, 0xDF, 0xE5,
-    0xE9, 0xE2, 0xCA, 0xD8, 0xDF, 0xD9, 0xCD, 0xD8, 0xC7, 0xDA, 0xE0, 0xAB, 0xC6, 0xCE, 0xCE, 0xD5,
-    0xC5, 0xB2, 0xC2, 0xD5, 0xC1, 0xCC, 0xC0, 0xBE, 0x87, 0x45, 0x21, 0x28, 0x43, 0x44, 0x3C, 0x37,
-    0x60, 0x3F, 0x25, 0x18, 0x23, 0x1B, 0x0D, 0x0D, 0x10, 0x0F, 0x15, 0x16, 0x12, 0x17, 0x0F, 0x18,
-    0x0F, 0x0E, 0x14, 0x14, 0x13, 0x0B, 0x0C, 0x0E, 0x0C, 0x0D, 0x29, 0x13, 0x19, 0x13, 0x20, 0x3C,
-    0x30, 0x2D, 0x1C, 0x11, 0x1C, 0x25, 0x0B, 0x0E, 0x2C, 0x6D, 0x42, 0x3D, 0x3C, 0x42, 0x32, 0x5A,
-    0x93, 0xBF, 0xCF, 0xBB, 0x90, 0x7E, 0x2F, 0x1C, 0x85, 0xB4, 0x4B, 0x3C, 0xB2, 0xD6, 0xE2, 0xE0,
-    0xC7, 0xDC, 0xDE, 0xE7, 0xD4, 0xD0, 0xD6, 0xC8, 0xD4, 0xD3, 0xB6, 0x8F, 0x7F, 0x9B, 0xC5, 0xC2,
-    0xBE, 0xD4, 0xC1, 0xB1, 0xCC, 0xD7, 0xC9, 0xCA, 0xB3, 0x9A, 0x94, 0x77, 0x4D, 0x55, 0x70, 0x46,
-    0x53, 0x3C, 0x51, 0x40, 0x48, 0x33, 0x35, 0x12, 0x0D, 0x0D, 0x13, 0x16, 0x1B, 0x18, 0x10, 0x1A,
-    0x0C, 0x0C, 0x10, 0x0D, 0x10, 0x0F, 0x0A, 0x0F, 0x18, 0x16, 0x10, 0x07, 0x14, 0x1B, 0x16, 0x1F,
-    0x1B, 0x17, 0x11, 0x04, 0x07, 0x06, 0x20, 0x45, 0x0A, 0x18, 0x21, 0x37, 0x54, 0x23, 0x0E, 0x00,
-    0x4B, 0xA6, 0x7C, 0x8C, 0xA7, 0xA7, 0x67, 0x2B, 0x1E, 0x35, 0x42, 0x41, 0x1F, 0x17, 0x35, 0x81,
-    0xB4, 0x96, 0xB1, 0xB7, 0xA6, 0xB6, 0xA1, 0x73, 0x7A, 0x81, 0x8F, 0x86, 0x4C, 0x50, 0x63, 0xB0,
-    0xBA, 0xC2, 0xBF, 0xC5, 0xBE, 0xB1, 0x98, 0xBB, 0xB7, 0xAA, 0x82, 0x94, 0x6C, 0x35, 0x4E, 0x47,
-    0x24, 0x23, 0x16, 0x13, 0x05, 0x0F, 0x42, 0x34, 0x21, 0x11, 0x1C, 0x24, 0x16, 0x1E, 0x0F, 0x08,
-    0x08, 0x0D, 0x09, 0x05, 0x0D, 0x0B, 0x15, 0x1B, 0x15, 0x09, 0x1D, 0x16, 0x15, 0x0D, 0x0F, 0x14,
-    0x15, 0x11, 0x16, 0x0D, 0x1D, 0x23, 0x18, 0x1B, 0x35, 0x3B, 0x2E, 0x62, 0x4D, 0x4E, 0x76, 0x94,
-    0x42, 0x41, 0x75, 0xBA, 0xA0, 0x46, 0x78, 0x93, 0x9E, 0x7D, 0x6B, 0x0F, 0x0A, 0x0E, 0x25, 0x66,
-    0x79, 0x50, 0x3B, 0x29, 0x39, 0x31, 0x24, 0x40, 0x35, 0x35, 0x2B, 0x46, 0x77, 0x7E, 0x68, 0xA0,
-    0x9E, 0xA8, 0xC2, 0xCB, 0xB2, 0xA4, 0xB7, 0xA8, 0x99, 0xC1, 0xA9, 0xB7, 0x8D, 0x7F, 0x45, 0x1B,
-    0x32, 0x22, 0x2E, 0x30, 0x32, 0x1F, 0x12, 0x1F, 0x30, 0x39, 0x2D, 0x26, 0x2A, 0x20, 0x11, 0x21,
-    0x1A, 0x0E, 0x09, 0x09, 0x07, 0x0E, 0x0A, 0x08, 0x0B, 0x11, 0x15, 0x07, 0x10, 0x0C, 0x0C, 0x09,
-    0x05, 0x07, 0x09, 0x0B, 0x0B, 0x1A, 0x25, 0x2B, 0x07, 0x0A, 0x13, 0x15, 0x6A, 0x61, 0x18, 0x1C,
-    0x2C, 0x41, 0x8E, 0x60, 0x36, 0x3B, 0x55, 0x38, 0x28, 0x70, 0x81, 0x7F, 0x39, 0x0F, 0x1A, 0x1D,
-    0x19, 0x44, 0x7D, 0x66, 0x94, 0x2B, 0x10, 0x13, 0x05, 0x08, 0x18, 0x06, 0x19, 0x46, 0x61, 0x43,
-    0x70, 0x9E, 0x84, 0x9F, 0xA6, 0xAE, 0x9E, 0xA8, 0xA5, 0x9B, 0xA9, 0xA8, 0xA5, 0x8A, 0x7F, 0x48,
-    0x1E, 0x0A, 0x11, 0x0C, 0x1C, 0x18, 0x28, 0x11, 0x12, 0x17, 0x39, 0x4C, 0x2F, 0x25, 0x18, 0x16,
-    0x16, 0x1B, 0x17, 0x12, 0x09, 0x0A, 0x05, 0x06, 0x06, 0x07, 0x0E, 0x16, 0x10, 0x08, 0x09, 0x0B,
-    0x09, 0x08, 0x08, 0x0B, 0x0B, 0x1C, 0x22, 0x2A, 0x49, 0x28, 0x0A, 0x19, 0x19, 0x33, 0x48, 0x1B,
-    0x34, 0x36, 0x4F, 0x68, 0x41, 0x2C, 0x2E, 0x29, 0x1A, 0x55, 0x4A, 0x78, 0xBD, 0x7F, 0x26, 0x63,
-    0x66, 0x49, 0x78, 0x4A, 0x78, 0x63, 0x3D, 0x51, 0x4B, 0x2C, 0x33, 0x59, 0x68, 0x6D, 0x71, 0x6E,
-    0x86, 0x71, 0xA9, 0x9E, 0xA0, 0xB2, 0xA6, 0xB1, 0xAA, 0x9A, 0xA2, 0xAC, 0x98, 0x92, 0xA0, 0x89,
-    0x5E, 0x25, 0x0C, 0x0E, 0x18, 0x21, 0x16, 0x19, 0x2A, 0x27, 0x1B, 0x39, 0x30, 0x22, 0x15, 0x17,
-    0x13, 0x11, 0x10, 0x1E, 0x1A, 0x0A, 0x0E, 0x0A, 0x05, 0x08, 0x07, 0x08, 0x0A, 0x0C, 0x0B, 0x07,
-    0x08, 0x08, 0x0B, 0x06, 0x06, 0x0E, 0x10, 0x17, 0x25, 0x2B, 0x39, 0x17, 0x16, 0x21, 0x23, 0x10,
-    0x0B, 0x13, 0x24, 0x3E, 0x76, 0x5A, 0x15, 0x1C, 0x22, 0x21, 0x1C, 0x2E, 0x7B, 0x68, 0x7B, 0x76,
-    0x52, 0x52, 0x36, 0x13, 0x1A, 0x24, 0x38, 0x24, 0x19, 0x48, 0x2F, 0x43, 0x72, 0x7C, 0x88, 0x8D,
-    0x73, 0x8E, 0xB6, 0x94, 0x7F, 0xA3, 0xB0, 0x9C, 0x97, 0x94, 0x92, 0x94, 0x9D, 0x89, 0x83, 0x98,
-    0x9A, 0x9A, 0x59, 0x1F, 0x10, 0x11, 0x1C, 0x14, 0x1B, 0x21, 0x2C, 0x1D, 0x15, 0x23, 0x14, 0x16,
-    0x14, 0x0D, 0x13, 0x17, 0x1A, 0x13, 0x0F, 0x0D, 0x0E, 0x06, 0x06, 0x07, 0x06, 0x08, 0x07, 0x08,
-    0x08, 0x07, 0x0A, 0x0E, 0x13, 0x18, 0x11, 0x1C, 0x19, 0x1F, 0x16, 0x26, 0x21, 0x1E, 0x18, 0x14,
-    0x29, 0x11, 0x13, 0x12, 0x21, 0x2D, 0x50, 0x4E, 0x2C, 0x15, 0x1B, 0x1A, 0x0D, 0x07, 0x15, 0x25,
-    0x2E, 0x2F, 0x34, 0x2C, 0x1F, 0x19, 0x0C, 0x14, 0x0F, 0x22, 0x44, 0x10, 0x5D, 0x81, 0x65, 0x78,
-    0x82, 0x8C, 0x63, 0x5D, 0x53, 0x4A, 0x4B, 0x98, 0x8D, 0x83, 0x83, 0x8F, 0x78, 0x71, 0x7F, 0x8B,
-    0x89, 0x85, 0x67, 0x61, 0x49, 0x26, 0x30, 0x1D, 0x11, 0x21, 0x26, 0x2C, 0x1F, 0x1F, 0x1C, 0x19,
-    0x18, 0x2A, 0x2B, 0x18, 0x14, 0x19, 0x12, 0x07, 0x07, 0x11, 0x0D, 0x0C, 0x05, 0x06, 0x0A, 0x07,
-    0x0A, 0x0A, 0x09, 0x0B, 0x0D, 0x19, 0x19, 0x27, 0x1F, 0x1E, 0x1B, 0x29, 0x28, 0x22, 0x22, 0x24,
-    0x1E, 0x1F, 0x2E, 0x23, 0x18, 0x16, 0x21, 0x37, 0x3F, 0x32, 0x12, 0x2C, 0x2C, 0x13, 0x14, 0x13,
-    0x12, 0x29, 0x55, 0x5F, 0x54, 0x32, 0x2F, 0x1F, 0x10, 0x15, 0x1C, 0x15, 0x1C, 0x11, 0x46, 0x87,
-    0x4F, 0x4C, 0x45, 0x37, 0x2C, 0x3D, 0x2A, 0x51, 0x83, 0x72, 0x7F, 0x99, 0x74, 0x8A, 0x83, 0x75,
-    0x86, 0x70, 0x7B, 0x86, 0x57, 0x43, 0x48, 0x3E, 0x30, 0x1D, 0x0D, 0x23, 0x35, 0x23, 0x21, 0x29,
-    0x2B, 0x2A, 0x23, 0x28, 0x2A, 0x24, 0x1B, 0x12, 0x13, 0x0B, 0x20, 0x1A, 0x0E, 0x12, 0x0D, 0x0C,
-    0x0A, 0x0A, 0x08, 0x07, 0x08, 0x0B, 0x05, 0x07, 0x0B, 0x13, 0x17, 0x19, 0x17, 0x10, 0x11, 0x16,
-    0x12, 0x2B, 0x17, 0x10, 0x14, 0x15, 0x15, 0x14, 0x0D, 0x3B, 0x28, 0x14, 0x0D, 0x2D, 0x34, 0x0F,
-    0x0A, 0x0A, 0x0B, 0x08, 0x0F, 0x23, 0x32, 0x10, 0x04, 0x06, 0x05, 0x06, 0x1D, 0x16, 0x06, 0x18,
-    0x0D, 0x14, 0x09, 0x1B, 0x20, 0x18, 0x2F, 0x33, 0x2C, 0x3A, 0x68, 0x5B, 0x54, 0x81, 0x61, 0x65,
-    0x92, 0x6F, 0x4F, 0x76, 0x5F, 0x4E, 0x48, 0x38, 0x33, 0x2A, 0x1F, 0x22, 0x0F, 0x0A, 0x08, 0x10,
-    0x21, 0x17, 0x17, 0x1E, 0x12, 0x12, 0x1F, 0x18, 0x14, 0x0E, 0x10, 0x0F, 0x0D, 0x0B, 0x0A, 0x09,
-    0x06, 0x05, 0x07, 0x07, 0x07, 0x08, 0x0F, 0x0E, 0x07, 0x07, 0x0F, 0x11, 0x20, 0x28, 0x1C, 0x0F,
-    0x11, 0x24, 0x21, 0x33, 0x34, 0x22, 0x1F, 0x12, 0x1D, 0x23, 0x2D, 0x14, 0x0F, 0x16, 0x10, 0x14,
-    0x22, 0x2C, 0x0F, 0x0E, 0x09, 0x0B, 0x0F, 0x17, 0x1F, 0x20, 0x1E, 0x1F, 0x23, 0x0F, 0x27, 0x37,
-    0x0D, 0x14, 0x23, 0x40, 0x3B, 0x3B, 0x2A, 0x36, 0x4D, 0x44, 0x25, 0x44, 0x59, 0x56, 0x76, 0x78,
-    0x6D, 0x7B, 0x6F, 0x56, 0x63, 0x7C, 0x8A, 0x58, 0x53, 0x35, 0x2D, 0x36, 0x25, 0x29, 0x28, 0x1A,
-    0x0E, 0x0D, 0x12, 0x1A, 0x18, 0x1E, 0x1D, 0x15, 0x1C, 0x12, 0x13, 0x13, 0x14, 0x11, 0x0C, 0x0F,
-    0x0E, 0x09, 0x0B, 0x0B, 0x12, 0x0A, 0x12, 0x13, 0x1E, 0x1B, 0x10, 0x16, 0x18, 0x17, 0x22, 0x30,
-    0x26, 0x1B, 0x21, 0x21, 0x31, 0x66, 0x43, 0x3B, 0x3F, 0x39, 0x34, 0x25, 0x26, 0x1D, 0x1F, 0x20,
-    0x14, 0x33, 0x3F, 0x36, 0x4F, 0x38, 0x1B, 0x24, 0x2D, 0x36, 0x2C, 0x47, 0x3F, 0x52, 0x88, 0x62,
-    0x70, 0x63, 0x2A, 0x1D, 0x2F, 0x64, 0x7B, 0x5A, 0x5F, 0x5C, 0x48, 0x70, 0x91, 0xAD, 0xBF, 0xBF,
-    0xC4, 0xC7, 0xBF, 0xC2, 0xBE, 0xB4, 0xC4, 0xAE, 0xBB, 0xBE, 0x9E, 0x66, 0x74, 0x61, 0x56, 0x53,
-    0x56, 0x60, 0x75, 0x58, 0x55, 0x50, 0x42, 0x61, 0x4C, 0x41, 0x3E, 0x25, 0x1A, 0x43, 0x30, 0x19,
-    0x19, 0x16, 0x15, 0x12, 0x11, 0x13, 0x1A, 0x0D, 0x10, 0x16, 0x13, 0x17, 0x16, 0x1B, 0x26, 0x1E,
-    0x20, 0x22, 0x2C, 0x14, 0x1E, 0x1A, 0x2E, 0x4B, 0x24, 0x34, 0x24, 0x2A, 0x21, 0x13, 0x18, 0x1A,
-    0x18, 0x14, 0x14, 0x1A, 0x23, 0x36, 0x39, 0x24, 0x1D, 0x13, 0x0E, 0x18, 0x21, 0x22, 0x22, 0x26,
-    0x49, 0x66, 0x62, 0x2F, 0x24, 0x18, 0x18, 0x19, 0x2A, 0x43, 0x4B, 0x5A, 0x49, 0x74, 0x87, 0x98,
-    0x8B, 0x95, 0x9D, 0xA8, 0x98, 0x92, 0x86, 0x8F, 0x91, 0x89, 0x8D, 0x9B, 0x81, 0x66, 0x55, 0x4D,
-    0x41, 0x3E, 0x3F, 0x42, 0x54, 0x40, 0x3E, 0x2F, 0x2F, 0x2A, 0x2C, 0x1F, 0x23, 0x2A, 0x13, 0x22,
-    0x1E, 0x1C, 0x1A, 0x13, 0x0E, 0x0D, 0x0C, 0x10, 0x0F, 0x0B, 0x08, 0x0D, 0x0C, 0x0B, 0x0A, 0x09,
-    0x14, 0x13, 0x0B, 0x0E, 0x11, 0x0A, 0x08, 0x07, 0x0F, 0x08, 0x11, 0x0E, 0x0A, 0x08, 0x06, 0x06,
-    0x05, 0x06, 0x04, 0x04, 0x06, 0x06, 0x13, 0x19, 0x09, 0x08, 0x0C, 0x06, 0x07, 0x07, 0x07, 0x04,
-    0x0E, 0x0D, 0x02, 0x11, 0x20, 0x0E, 0x13, 0x07, 0x06, 0x06, 0x04, 0x09, 0x07, 0x0D, 0x21, 0x29,
-    0x16, 0x29, 0x31, 0x3D, 0x3B, 0x3A, 0x45, 0x2E, 0x36, 0x39, 0x40, 0x33, 0x33, 0x2F, 0x2C, 0x2F,
-    0x1B, 0x15, 0x1B, 0x10, 0x10, 0x0C, 0x0C, 0x1B, 0x18, 0x1F, 0x1C, 0x10, 0x1A, 0x13, 0x0B, 0x07,
-    0x06, 0x03, 0x09, 0x0E, 0x0C, 0x05, 0x05, 0x04, 0x09, 0x0B, 0x05, 0x07, 0x06, 0x0A, 0x0A, 0x0B,
-    0x0C, 0x0A, 0x0B, 0x11, 0x09, 0x11, 0x14, 0x0D, 0x05, 0x08, 0x0A, 0x10, 0x0F, 0x0B, 0x0C, 0x13,
-    0x10, 0x06, 0x05, 0x07, 0x04, 0x07, 0x07, 0x0D, 0x16, 0x1D, 0x15, 0x0A, 0x08, 0x0B, 0x0B, 0x08,
-    0x07, 0x0A, 0x1A, 0x1D, 0x09, 0x11, 0x18, 0x19, 0x16, 0x0A, 0x0A, 0x08, 0x0A, 0x0C, 0x0E, 0x07,
-    0x07, 0x17, 0x2A, 0x23, 0x33, 0x37, 0x2A, 0x2A, 0x34, 0x2F, 0x3F, 0x3B, 0x30, 0x1B, 0x1E, 0x25,
-    0x13, 0x15, 0x14, 0x13, 0x0E, 0x0C, 0x07, 0x07, 0x07, 0x0C, 0x0B, 0x08, 0x0D, 0x0D, 0x0D, 0x0A,
-    0x0B, 0x08, 0x05, 0x06, 0x07, 0x0A, 0x07, 0x07, 0x06, 0x06, 0x08, 0x06, 0x08, 0x06, 0x08, 0x0D,
-    0x09, 0x0A, 0x08, 0x0A, 0x08, 0x12, 0x0E, 0x0E, 0x14, 0x10, 0x08, 0x0C, 0x0A, 0x0D, 0x0D, 0x0F,
-    0x10, 0x13, 0x13, 0x0C, 0x06, 0x07, 0x06, 0x0B, 0x0A, 0x17, 0x19, 0x14, 0x0D, 0x07, 0x09, 0x08,
-    0x06, 0x08, 0x06, 0x0B, 0x11, 0x0E, 0x1A, 0x16, 0x0C, 0x21, 0x15, 0x0C, 0x17, 0x14, 0x0C, 0x14,
-    0x21, 0x12, 0x12, 0x1E, 0x2D, 0x2C, 0x30, 0x25, 0x26, 0x2D, 0x27, 0x2E, 0x27, 0x28, 0x24, 0x27,
-    0x2D, 0x28, 0x20, 0x1C, 0x17, 0x15, 0x0A, 0x09, 0x08, 0x05, 0x07, 0x0B, 0x0B, 0x0A, 0x10, 0x11,
-    0x0C, 0x0D, 0x0C, 0x0C, 0x07, 0x08, 0x0A, 0x0A, 0x05, 0x0A, 0x07, 0x09, 0x0A, 0x08, 0x07, 0x06,
-    0x05, 0x0A, 0x0A, 0x08, 0x05, 0x09, 0x0C, 0x0B, 0x0C, 0x0A, 0x08, 0x0A, 0x09, 0x07, 0x08, 0x0B,
-    0x0C, 0x0E, 0x13, 0x0B, 0x13, 0x11, 0x09, 0x08, 0x06, 0x08, 0x0A, 0x11, 0x14, 0x09, 0x05, 0x05,
-    0x04, 0x05, 0x05, 0x06, 0x05, 0x0A, 0x0C, 0x0F, 0x10, 0x0D, 0x0A, 0x0D, 0x11, 0x0E, 0x0F, 0x12,
-    0x13, 0x10, 0x16, 0x0E, 0x13, 0x0C, 0x16, 0x1B, 0x0E, 0x11, 0x16, 0x19, 0x16, 0x1E, 0x1A, 0x14,
-    0x0D, 0x16, 0x12, 0x0C, 0x11, 0x0B, 0x0B, 0x08, 0x08, 0x0B, 0x07, 0x01, 0x03, 0x07, 0x0B, 0x0C,
-    0x06, 0x09, 0x09, 0x04, 0x09, 0x06, 0x05, 0x05, 0x08, 0x07, 0x05, 0x06, 0x07, 0x08, 0x05, 0x06,
-    0x04, 0x04, 0x08, 0x0B, 0x09, 0x0B, 0x0C, 0x0D, 0x0D, 0x0C, 0x0E, 0x0F, 0x0A, 0x0C, 0x0C, 0x0C,
-    0x12, 0x11, 0x14, 0x13, 0x15, 0x14, 0x14, 0x1C, 0x16, 0x0F, 0x0F, 0x10, 0x14, 0x10, 0x0E, 0x09,
-    0x06, 0x06, 0x07, 0x08, 0x0B, 0x08, 0x0A, 0x0C, 0x1B, 0x1C, 0x0F, 0x15, 0x0F, 0x12, 0x14, 0x16,
-    0x0E, 0x13, 0x14, 0x12, 0x1D, 0x16, 0x19, 0x17, 0x14, 0x1B, 0x10, 0x18, 0x1B, 0x15, 0x19, 0x16,
-    0x19, 0x16, 0x11, 0x10, 0x17, 0x10, 0x08, 0x06, 0x0A, 0x0A, 0x0B, 0x0A, 0x08, 0x05, 0x06, 0x0C,
-    0x11, 0x0E, 0x0B, 0x0D, 0x0B, 0x03, 0x0B, 0x06, 0x05, 0x08, 0x07, 0x0B, 0x0A, 0x09, 0x0C, 0x09,
-    0x03, 0x05, 0x05, 0x04
-};
@@ -1,261 +0,0 @@
-
-
-
-
-#include "types.h"
-
-int SCP079_FACE2_WIDTH = 80;
-int SCP079_FACE2_HEIGHT = 50;
-
-uint8_t scp079_face2_data[] = {
-    0x06, 0x05, 0x05, 0x05, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x0A, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B,
-    0x0B, 0x0B, 0x0A, 0x0A, 0x09, 0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03,
-    0x08, 0x07, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06,
-    0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x08, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09,
-    0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A, 0x0A, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05,
-    0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05,
-    0x08, 0x08, 0x07, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x0B, 0x0B, 0x0B, 0x0A, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0C, 0x0B, 0x0A, 0x09, 0x09, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06,
-    0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x09, 0x09, 0x09,
-    0x0A, 0x09, 0x09, 0x08, 0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0B, 0x0D, 0x0D,
-    0x0D, 0x0D, 0x0D, 0x0E, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B,
-    0x0A, 0x0A, 0x0B, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08,
-    0x08, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x09, 0x08,
-    0x0A, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x06, 0x05, 0x06, 0x07,
-    0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x06, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A,
-    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0B, 0x0C, 0x0C, 0x0C, 0x0B,
-    0x0A, 0x0A, 0x09, 0x08, 0x08, 0x08, 0x07, 0x07, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x05,
-    0x05, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x04,
-    0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x08, 0x0B, 0x15, 0x24, 0x33, 0x3A, 0x3A,
-    0x3A, 0x3B, 0x3D, 0x3E, 0x3E, 0x3E, 0x3A, 0x2C, 0x1B, 0x10, 0x09, 0x0A, 0x09, 0x07, 0x07, 0x07,
-    0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0A, 0x0A, 0x0A,
-    0x09, 0x09, 0x08, 0x08, 0x0A, 0x0B, 0x13, 0x22, 0x31, 0x36, 0x37, 0x37, 0x38, 0x38, 0x38, 0x37,
-    0x37, 0x31, 0x23, 0x15, 0x0B, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x07, 0x05, 0x06, 0x05,
-    0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x08, 0x09, 0x08, 0x0C, 0x16, 0x64, 0xDD, 0xE4, 0xE8, 0xE9,
-    0xE9, 0xEA, 0xEA, 0xE9, 0xE9, 0xEA, 0xE6, 0xDF, 0x6C, 0x1B, 0x0E, 0x0A, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C,
-    0x0B, 0x0A, 0x09, 0x0A, 0x0C, 0x14, 0x46, 0xD2, 0xE4, 0xE8, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE8,
-    0xE9, 0xE4, 0xDC, 0x63, 0x17, 0x0C, 0x08, 0x08, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x09, 0x0E, 0x22, 0x92, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x98, 0x27, 0x10, 0x0A, 0x0B, 0x0A, 0x0A, 0x0A,
-    0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0E, 0x0E,
-    0x0E, 0x0D, 0x0C, 0x0B, 0x0C, 0x1F, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8F, 0x22, 0x0E, 0x09, 0x09, 0x08, 0x08, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09,
-    0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x0A, 0x0D, 0x24, 0x93, 0xFD, 0xFC, 0xFE, 0xFE,
-    0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFD, 0x9D, 0x2B, 0x0F, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B,
-    0x0C, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-    0x0F, 0x0E, 0x0E, 0x0D, 0x0E, 0x22, 0x76, 0xF9, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
-    0xFE, 0xFB, 0xFD, 0x8F, 0x23, 0x0D, 0x09, 0x08, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-    0x0C, 0x0D, 0x0C, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0E, 0x25, 0x95, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x9C, 0x2A, 0x0E, 0x0A, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x0A, 0x0A, 0x09, 0x09, 0x0A, 0x0C, 0x0D, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x11, 0x10, 0x10,
-    0x10, 0x10, 0x0F, 0x0D, 0x10, 0x25, 0x75, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xFF, 0x8F, 0x23, 0x0C, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07,
-    0x0A, 0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0D, 0x25, 0x95, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x9D, 0x2B, 0x10, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C,
-    0x0B, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x10, 0x10, 0x11, 0x12, 0x12, 0x13, 0x12, 0x13,
-    0x13, 0x12, 0x13, 0x13, 0x14, 0x2A, 0x7B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xFF, 0x90, 0x23, 0x0C, 0x09, 0x0A, 0x09, 0x09, 0x08, 0x06, 0x05, 0x05, 0x04, 0x04,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x0E, 0x24, 0x93, 0xFE, 0xFD, 0xFE, 0xFE,
-    0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x9B, 0x29, 0x10, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
-    0x0C, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13, 0x14, 0x16, 0x16,
-    0x17, 0x16, 0x16, 0x16, 0x17, 0x2C, 0x7D, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-    0xFE, 0xFD, 0xFE, 0x91, 0x24, 0x0C, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x05, 0x04,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0E, 0x23, 0x91, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x9E, 0x2B, 0x0E, 0x08, 0x09, 0x08, 0x0A, 0x0C,
-    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x10, 0x10, 0x12, 0x13, 0x13, 0x14, 0x15,
-    0x16, 0x14, 0x16, 0x15, 0x18, 0x30, 0x85, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x91, 0x25, 0x0E, 0x0A, 0x0B, 0x0B, 0x09, 0x09, 0x09, 0x09, 0x07, 0x06, 0x05,
-    0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0C, 0x0B, 0x0B, 0x0B, 0x0E, 0x1B, 0x6F, 0xED, 0xF1, 0xF5, 0xF6,
-    0xF8, 0xF7, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x8B, 0x73, 0x6E, 0x6A, 0x5D, 0x35, 0x17,
-    0x0E, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x20,
-    0x3C, 0x67, 0x77, 0x7D, 0x7E, 0x90, 0xBA, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xF7, 0xF7,
-    0xF6, 0xF2, 0xEE, 0x70, 0x1C, 0x0F, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B, 0x0B,
-    0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x0B, 0x10, 0x1F, 0x3A, 0x49, 0x51, 0x53,
-    0x6D, 0xAC, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x25,
-    0x11, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0E, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x18, 0x2D,
-    0x8A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xB2, 0x71, 0x59,
-    0x55, 0x50, 0x3D, 0x23, 0x12, 0x0D, 0x0D, 0x0C, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0C, 0x0B, 0x0B,
-    0x0B, 0x0B, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x0C, 0x0A, 0x0A, 0x0A, 0x0D,
-    0x24, 0x83, 0xFB, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFF, 0xB3, 0x30,
-    0x11, 0x0A, 0x0A, 0x0A, 0x09, 0x0A, 0x0A, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x0F, 0x10, 0x16, 0x33,
-    0x9D, 0xFF, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0x90, 0x2F, 0x14,
-    0x11, 0x10, 0x0F, 0x0F, 0x0E, 0x0E, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B,
-    0x0F, 0x0E, 0x0D, 0x0C, 0x0C, 0x0B, 0x0A, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x11,
-    0x25, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xB9, 0x3B,
-    0x15, 0x0E, 0x0E, 0x0C, 0x0A, 0x0D, 0x0B, 0x0B, 0x0D, 0x0F, 0x0D, 0x10, 0x14, 0x15, 0x19, 0x38,
-    0xA2, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x31, 0x17,
-    0x12, 0x13, 0x11, 0x10, 0x0F, 0x0E, 0x0E, 0x0D, 0x0C, 0x0D, 0x0D, 0x0F, 0x0F, 0x11, 0x10, 0x11,
-    0x0B, 0x0C, 0x0C, 0x0C, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0C, 0x0E,
-    0x1A, 0x55, 0xD3, 0xE3, 0xE7, 0xE7, 0xEC, 0xEF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD9, 0xA5,
-    0x8C, 0x85, 0x83, 0x76, 0x4B, 0x1A, 0x12, 0x0D, 0x11, 0x19, 0x49, 0x79, 0x87, 0x8D, 0x8F, 0xA4,
-    0xCF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xF1, 0xEF, 0xEA, 0xEA, 0xE6, 0xDB, 0x66, 0x23, 0x13,
-    0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0A, 0x0A, 0x09, 0x09,
-    0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 0x0D, 0x0E,
-    0x11, 0x1B, 0x2A, 0x38, 0x40, 0x3F, 0x53, 0x89, 0xEE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x2E, 0x16, 0x0D, 0x15, 0x2D, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xA4, 0x62, 0x4A, 0x47, 0x42, 0x33, 0x24, 0x19, 0x12,
-    0x11, 0x10, 0x0F, 0x0F, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0D, 0x0B, 0x0B, 0x0B,
-    0x10, 0x0F, 0x0E, 0x0D, 0x0D, 0x0C, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0E, 0x0E,
-    0x0E, 0x0F, 0x0F, 0x0E, 0x0E, 0x0F, 0x1B, 0x5E, 0xE9, 0xFC, 0xFC, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE,
-    0xFD, 0xFD, 0xFB, 0xFD, 0xC1, 0x3A, 0x16, 0x0D, 0x14, 0x37, 0xB9, 0xFD, 0xFB, 0xFD, 0xFD, 0xFE,
-    0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0x80, 0x28, 0x12, 0x10, 0x12, 0x12, 0x13, 0x14, 0x13,
-    0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0C, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B,
-    0x11, 0x0F, 0x0D, 0x0C, 0x0C, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0A, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C,
-    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x10, 0x1D, 0x55, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xC8, 0x4B, 0x22, 0x17, 0x21, 0x4A, 0xC2, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0x26, 0x14, 0x12, 0x14, 0x12, 0x11, 0x10, 0x10,
-    0x0F, 0x0F, 0x0F, 0x0D, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
-    0x0A, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
-    0x0C, 0x0B, 0x0D, 0x0E, 0x0E, 0x0E, 0x16, 0x32, 0x9C, 0xC1, 0xC7, 0xCA, 0xCF, 0xDA, 0xF1, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xE7, 0xC1, 0xB3, 0xAD, 0xB3, 0xC3, 0xE4, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xF7, 0xDD, 0xD2, 0xCA, 0xC9, 0xC4, 0xB3, 0x47, 0x1B, 0x12, 0x10, 0x11, 0x10, 0x0F, 0x0E, 0x0E,
-    0x0E, 0x0F, 0x0F, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
-    0x0E, 0x0F, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
-    0x0D, 0x0C, 0x0D, 0x0D, 0x0C, 0x0C, 0x0D, 0x11, 0x14, 0x1C, 0x24, 0x23, 0x31, 0x65, 0xDB, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xEF, 0x78, 0x38, 0x24, 0x25, 0x22, 0x1A, 0x17, 0x11, 0x0E, 0x0E, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E,
-    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0A,
-    0x0C, 0x0C, 0x0B, 0x0B, 0x0A, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
-    0x0B, 0x0A, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x08, 0x08, 0x08, 0x10, 0x3D, 0xD3, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFC, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xEC, 0x5C, 0x19, 0x0C, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x0C,
-    0x0C, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 0x10,
-    0x0F, 0x0F, 0x0E, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A, 0x09, 0x08, 0x07,
-    0x08, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x07, 0x12, 0x3E, 0xD2, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xEC, 0x5E, 0x1C, 0x0E, 0x0D, 0x0D, 0x0D, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x09, 0x0A, 0x0A, 0x0A,
-    0x0A, 0x0C, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x0C, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0E, 0x0F,
-    0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0A, 0x0B, 0x0B,
-    0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x12, 0x3C, 0xD2, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xEC, 0x5D, 0x1A, 0x0C, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0D,
-    0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0D, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0A, 0x0A, 0x08, 0x07, 0x07,
-    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0A, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0A, 0x0A,
-    0x0A, 0x0A, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x08, 0x08, 0x09, 0x08, 0x13, 0x3D, 0xD2, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xEB, 0x5C, 0x1B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0B, 0x0C, 0x0D,
-    0x0D, 0x0E, 0x0F, 0x0F, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x11, 0x11, 0x12,
-    0x07, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x09, 0x0A, 0x0A, 0x0A, 0x09, 0x08, 0x0A, 0x0A, 0x08, 0x08,
-    0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x10, 0x3D, 0xD3, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xEC, 0x5A, 0x18, 0x0C, 0x0C, 0x0D, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x10,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x10, 0x0F, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0C,
-    0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0B, 0x0A, 0x0A,
-    0x09, 0x08, 0x07, 0x07, 0x07, 0x07, 0x0A, 0x0F, 0x14, 0x21, 0x2B, 0x2D, 0x3B, 0x6A, 0xDC, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xEF, 0x80, 0x44, 0x32, 0x32, 0x2B, 0x1E, 0x16, 0x12, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E,
-    0x0E, 0x0F, 0x0F, 0x0F, 0x0E, 0x0D, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0A, 0x0A,
-    0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0C, 0x0B, 0x0C, 0x0A, 0x09,
-    0x09, 0x0A, 0x08, 0x09, 0x09, 0x08, 0x10, 0x2B, 0xAB, 0xD2, 0xD7, 0xDA, 0xDF, 0xE5, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xE1, 0xB0, 0x9C, 0x94, 0x9D, 0xB0, 0xDE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE,
-    0xF9, 0xE9, 0xE1, 0xDB, 0xDB, 0xD6, 0xC5, 0x4C, 0x1D, 0x11, 0x11, 0x0F, 0x10, 0x11, 0x11, 0x11,
-    0x10, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0D, 0x0E, 0x0D, 0x0C, 0x0C, 0x0A, 0x08, 0x06, 0x04, 0x03,
-    0x0B, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0D, 0x0C, 0x0D, 0x0D, 0x0E, 0x0D, 0x0B, 0x0A,
-    0x0A, 0x0A, 0x09, 0x0A, 0x08, 0x09, 0x13, 0x49, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xC7, 0x45, 0x19, 0x0F, 0x19, 0x41, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0x28, 0x13, 0x12, 0x12, 0x11, 0x10, 0x0F, 0x0F,
-    0x0F, 0x0E, 0x0F, 0x0D, 0x0B, 0x0B, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x08, 0x05, 0x04,
-    0x07, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0D, 0x0C, 0x0D, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B,
-    0x0B, 0x0A, 0x08, 0x07, 0x06, 0x07, 0x13, 0x56, 0xEA, 0xFD, 0xFC, 0xFD, 0xFD, 0xFE, 0xFF, 0xFE,
-    0xFE, 0xFD, 0xFB, 0xFE, 0xC1, 0x3B, 0x15, 0x0C, 0x14, 0x37, 0xBA, 0xFE, 0xFB, 0xFE, 0xFE, 0xFE,
-    0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0x7E, 0x27, 0x0F, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 0x0E,
-    0x0E, 0x0E, 0x0E, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0A, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07,
-    0x0A, 0x0A, 0x09, 0x0A, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x09, 0x09,
-    0x0C, 0x15, 0x27, 0x36, 0x3D, 0x3F, 0x51, 0x87, 0xED, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x2C, 0x15, 0x0C, 0x13, 0x2B, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xA3, 0x65, 0x4C, 0x4A, 0x43, 0x33, 0x1F, 0x14, 0x0F,
-    0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0C, 0x0B, 0x0A, 0x09, 0x0A, 0x0A, 0x08,
-    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x0A, 0x0A, 0x09, 0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x0A,
-    0x14, 0x4D, 0xD8, 0xEA, 0xEC, 0xEE, 0xF1, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD4, 0x9A,
-    0x82, 0x7D, 0x78, 0x6C, 0x43, 0x18, 0x10, 0x0B, 0x10, 0x1A, 0x42, 0x6D, 0x7A, 0x7D, 0x7F, 0x98,
-    0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF3, 0xF4, 0xF1, 0xF0, 0xEC, 0xE2, 0x62, 0x1D, 0x0E,
-    0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0A, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x07, 0x07, 0x06, 0x05,
-    0x0B, 0x0B, 0x0A, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x0E,
-    0x1D, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFE, 0xFC, 0xFE, 0xB7, 0x36,
-    0x13, 0x0D, 0x0E, 0x0C, 0x0E, 0x10, 0x0E, 0x0F, 0x0F, 0x11, 0x0F, 0x0C, 0x0F, 0x10, 0x14, 0x31,
-    0x99, 0xFE, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x27, 0x12,
-    0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0C, 0x0B, 0x0C, 0x0B, 0x0B, 0x0A, 0x09, 0x09, 0x0A, 0x08, 0x08,
-    0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x08, 0x05, 0x05, 0x05, 0x08,
-    0x1A, 0x78, 0xFB, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x2E,
-    0x10, 0x0A, 0x0C, 0x0D, 0x0C, 0x0D, 0x0C, 0x0C, 0x0D, 0x0E, 0x0F, 0x0F, 0x10, 0x10, 0x14, 0x2E,
-    0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFE, 0x8C, 0x29, 0x11,
-    0x0E, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B, 0x0A, 0x0B, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0E, 0x23, 0x48, 0x58, 0x5E, 0x5F,
-    0x74, 0xAC, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xF9, 0xFA, 0xF9, 0xF9, 0xF5, 0xF4, 0x8E, 0x1C,
-    0x0D, 0x07, 0x08, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0C, 0x0D, 0x0D, 0x0F, 0x10, 0x12, 0x22,
-    0x77, 0xF4, 0xF7, 0xFA, 0xFB, 0xFC, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xB9, 0x82, 0x6B,
-    0x69, 0x63, 0x54, 0x2B, 0x13, 0x0D, 0x0C, 0x0B, 0x0B, 0x0B, 0x0A, 0x08, 0x07, 0x06, 0x04, 0x04,
-    0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07, 0x08, 0x07, 0x0D, 0x19, 0x75, 0xFC, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xB8, 0x70, 0x53, 0x50, 0x4A, 0x3F, 0x22, 0x0E,
-    0x08, 0x07, 0x07, 0x07, 0x08, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x10, 0x10, 0x15,
-    0x28, 0x49, 0x5A, 0x5F, 0x60, 0x77, 0xAC, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFC, 0x75, 0x1A, 0x0D, 0x09, 0x09, 0x0A, 0x09, 0x08, 0x08, 0x07, 0x06, 0x06, 0x06,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x0C, 0x23, 0x92, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x95, 0x1E, 0x09, 0x05, 0x05, 0x05, 0x07, 0x07,
-    0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0C, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12,
-    0x12, 0x10, 0x11, 0x12, 0x12, 0x28, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFE, 0xFF, 0x92, 0x27, 0x0D, 0x08, 0x09, 0x09, 0x08, 0x07, 0x08, 0x08, 0x07, 0x08, 0x08,
-    0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x07, 0x08, 0x08, 0x0C, 0x21, 0x8F, 0xFE, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x94, 0x21, 0x0E, 0x09, 0x09, 0x0A, 0x0A, 0x0A,
-    0x0A, 0x0B, 0x0C, 0x0C, 0x0C, 0x0D, 0x0C, 0x0C, 0x0D, 0x0F, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x10,
-    0x11, 0x11, 0x12, 0x12, 0x12, 0x27, 0x79, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFE, 0x8E, 0x20, 0x09, 0x05, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07, 0x07,
-    0x09, 0x09, 0x08, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0A, 0x1E, 0x8D, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x95, 0x24, 0x0F, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D,
-    0x0D, 0x0D, 0x0E, 0x0F, 0x0F, 0x0F, 0x0E, 0x0F, 0x10, 0x0F, 0x0E, 0x0F, 0x0F, 0x0F, 0x10, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x12, 0x27, 0x7A, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xFF, 0x8D, 0x1D, 0x08, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x07,
-    0x07, 0x06, 0x06, 0x05, 0x04, 0x06, 0x06, 0x06, 0x06, 0x0A, 0x1D, 0x8C, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x95, 0x24, 0x0E, 0x0B, 0x0B, 0x0A, 0x0A, 0x0A,
-    0x0C, 0x0B, 0x0B, 0x0C, 0x0D, 0x0D, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x10, 0x10, 0x10, 0x12, 0x12,
-    0x12, 0x12, 0x12, 0x13, 0x14, 0x29, 0x7B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0x8A, 0x1D, 0x0A, 0x06, 0x07, 0x09, 0x08, 0x08, 0x07, 0x06, 0x06, 0x06, 0x05,
-    0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0A, 0x1D, 0x8C, 0xFC, 0xFA, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFB, 0xFD, 0x95, 0x25, 0x0F, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A,
-    0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x0E,
-    0x0E, 0x0F, 0x0E, 0x0E, 0x0F, 0x22, 0x77, 0xFA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFB, 0xFC, 0x88, 0x1D, 0x09, 0x05, 0x06, 0x06, 0x06, 0x07, 0x06, 0x07, 0x09, 0x09, 0x0A,
-    0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x09, 0x16, 0x87, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x20, 0x0C, 0x08, 0x09, 0x08, 0x08, 0x09,
-    0x09, 0x09, 0x09, 0x0A, 0x0C, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0F, 0x0F, 0x10, 0x11, 0x12, 0x10,
-    0x10, 0x10, 0x10, 0x0F, 0x0F, 0x21, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x83, 0x19, 0x09, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09,
-    0x0C, 0x0B, 0x09, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x0C, 0x4F, 0xC4, 0xCD, 0xD2, 0xD4,
-    0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD3, 0xCA, 0x5D, 0x16, 0x0D, 0x09, 0x0A, 0x09, 0x0A, 0x0B,
-    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
-    0x0D, 0x0D, 0x0C, 0x0C, 0x0F, 0x17, 0x44, 0xC1, 0xD5, 0xD8, 0xD8, 0xD8, 0xD8, 0xD7, 0xD6, 0xD6,
-    0xD5, 0xCF, 0xC5, 0x50, 0x0E, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x05, 0x06, 0x06, 0x06, 0x06,
-    0x05, 0x05, 0x04, 0x04, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x08, 0x0D, 0x18, 0x1E, 0x20,
-    0x1F, 0x20, 0x21, 0x21, 0x21, 0x22, 0x20, 0x17, 0x10, 0x0B, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09,
-    0x0A, 0x0B, 0x0B, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B,
-    0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0D, 0x14, 0x1A, 0x25, 0x2A, 0x2A, 0x2A, 0x28, 0x26, 0x24, 0x22,
-    0x20, 0x1A, 0x0F, 0x0B, 0x08, 0x06, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08,
-    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x04, 0x04,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x07, 0x07, 0x08, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A,
-    0x0B, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0D, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D,
-    0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0D, 0x0C, 0x0B, 0x09, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07,
-    0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x07, 0x06, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06,
-    0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x04, 0x04, 0x03, 0x03, 0x04, 0x06, 0x06, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x04, 0x06, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x0B, 0x0B, 0x0A, 0x0A,
-    0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D,
-    0x0D, 0x0D, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x09, 0x08, 0x08, 0x08, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x04, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02,
-    0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
-    0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0B, 0x0C, 0x0C,
-    0x0B, 0x0B, 0x0A, 0x0A, 0x0A, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05,
-    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02,
-    0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06, 0x05, 0x06, 0x07, 0x07, 0x06,
-    0x06, 0x05, 0x05, 0x05, 0x06, 0x07, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09,
-    0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0B,
-    0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x09, 0x08, 0x09, 0x08, 0x08, 0x08, 0x07, 0x07, 0x08, 0x07, 0x06,
-    0x06, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05
-};
@@ -0,0 +1,210 @@
+#include "smooth_font.h"
+
+
+uint8_t SmoothFont::coverage_6x8[SMOOTH_FONT_GLYPHS][6 * 8 / 2];
+uint8_t SmoothFont::coverage_8x12[SMOOTH_FONT_GLYPHS][8 * 12 / 2];
+bool SmoothFont::coverage_ready[FONT_FACE_COUNT];
+GlyphCacheSlot SmoothFont::slots[SMOOTH_FONT_CACHE_SLOTS];
+uint32_t SmoothFont::use_clock = 0;
+
+static const uint8_t face_width[FONT_FACE_COUNT] = {6, 8};
+static const uint8_t face_height[FONT_FACE_COUNT] = {8, 12};
+
+int SmoothFont::get_width(FontFace face) {
+    return face_width[face];
+}
+
+
+int SmoothFont::get_height(FontFace face) {
+    return face_height[face];
+}
+
+
+static inline bool lit(const uint8_t* rows, int x, int y) {
+    if (x < 0 || x >= 8 || y < 0 || y >= 8) {
+        return false;
+    }
+    return rows[y] & (0x80 >> x);
+}
+
+
+void SmoothFont::build_coverage(FontFace face) {
+    const int width = face_width[face];
+    const int height = face_height[face];
+    uint8_t* base = face == FONT_FACE_6X8 ? coverage_6x8[0] : coverage_8x12[0];
+    const int glyph_bytes = width * height / 2;
+
+    for (int g = 0; g < SMOOTH_FONT_GLYPHS; g++) {
+        const uint8_t* rows = Graphics::get_glyph((char)(SMOOTH_FONT_FIRST + g));
+
+        
+        bool big[16][16];
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < 8; x++) {
+                bool p = lit(rows, x, y);
+                bool a = lit(rows, x, y - 1);
+                bool b = lit(rows, x + 1, y);
+                bool c = lit(rows, x - 1, y);
+                bool d = lit(rows, x, y + 1);
+                big[y * 2][x * 2] = (c == a && c != d && a != b) ? a : p;
+                big[y * 2][x * 2 + 1] = (a == b && a != c && b != d) ? b : p;
+                big[y * 2 + 1][x * 2] = (d == c && d != b && c != a) ? c : p;
+                big[y * 2 + 1][x * 2 + 1] = (b == d && b != a && d != c) ? d : p;
+            }
+        }
+
+        
+        uint8_t* out = base + g * glyph_bytes;
+        for (int i = 0; i < glyph_bytes; i++) {
+            out[i] = 0;
+        }
+        for (int oy = 0; oy < height; oy++) {
+            for (int ox = 0; ox < width; ox++) {
+                int area = 0;
+                for (int sy = oy * 16 / height; sy < 16 && sy * height < (oy + 1) * 16; sy++) {
+                    int y0 = sy * height > oy * 16 ? sy * height : oy * 16;
+                    int y1 = (sy + 1) * height < (oy + 1) * 16 ? (sy + 1) * height : (oy + 1) * 16;
+                    for (int sx = ox * 16 / width; sx < 16 && sx * width < (ox + 1) * 16; sx++) {
+                        if (!big[sy][sx]) {
+                            continue;
+                        }
+                        int x0 = sx * width > ox * 16 ? sx * width : ox * 16;
+                        int x1 = (sx + 1) * width < (ox + 1) * 16 ? (sx + 1) * width : (ox + 1) * 16;
+                        area += (x1 - x0) * (y1 - y0);
+                    }
+                }
+
+                int level = (area * 15 + 128) >> 8;
+                int index = oy * width + ox;
+                out[index >> 1] |= (index & 1) ? level : level << 4;
+            }
+        }
+    }
+    coverage_ready[face] = true;
+}
+
+
+const Surface* SmoothFont::get_atlas(FontFace face, uint8_t fg, uint8_t bg) {
+    uint32_t generation = Graphics::get_palette_generation();
+    GlyphCacheSlot* victim = &slots[0];
+    use_clock++;
+
+    for (int i = 0; i < SMOOTH_FONT_CACHE_SLOTS; i++) {
+        GlyphCacheSlot* slot = &slots[i];
+        if (slot->valid && slot->generation != generation) {
+            slot->valid = false;
+            slot->last_used = 0;
+        }
+        if (slot->valid && slot->face == face && slot->fg == fg && slot->bg == bg) {
+            slot->last_used = use_clock;
+            return &slot->atlas;
+        }
+        if (slot->last_used < victim->last_used) {
+            victim = slot;
+        }
+    }
+
+    
+    if (!victim->atlas.pixels &&
+        !Graphics::create_surface(&victim->atlas, 0, 0, SMOOTH_FONT_GLYPHS * 8, 12)) {
+        return nullptr;
+    }
+    if (!coverage_ready[face]) {
+        build_coverage(face);
+    }
+
+    
+    const uint8_t* palette = Graphics::get_palette();
+    const uint8_t* from = palette + bg * 3;
+    const uint8_t* to = palette + fg * 3;
+    uint8_t ramp[16];
+    for (int k = 0; k < 16; k++) {
+        ramp[k] = Graphics::nearest_color((uint8_t)(from[0] + (to[0] - from[0]) * k / 15),
+                                          (uint8_t)(from[1] + (to[1] - from[1]) * k / 15),
+                                          (uint8_t)(from[2] + (to[2] - from[2]) * k / 15));
+    }
+    ramp[0] = bg;
+    ramp[15] = fg;
+
+    const int width = face_width[face];
+    const int height = face_height[face];
+    const uint8_t* coverage = face == FONT_FACE_6X8 ? coverage_6x8[0] : coverage_8x12[0];
+    uint8_t* pixels = victim->atlas.pixels;
+    const int pitch = victim->atlas.pitch;
+    for (int g = 0; g < SMOOTH_FONT_GLYPHS; g++) {
+        for (int index = 0; index < width * height; index++) {
+            uint8_t packed = coverage[index >> 1];
+            uint8_t level = (index & 1) ? packed & 0x0F : packed >> 4;
+            pixels[(index / width) * pitch + g * width + index % width] = ramp[level];
+        }
+        coverage += width * height / 2;
+    }
+
+    victim->face = face;
+    victim->fg = fg;
+    victim->bg = bg;
+    victim->generation = generation;
+    victim->last_used = use_clock;
+    victim->valid = true;
+    return &victim->atlas;
+}
+
+void SmoothFont::draw_char(FontFace face, int x, int y, char c, uint8_t fg, uint8_t bg) {
+    const Surface* atlas = get_atlas(face, fg, bg);
+    if (!atlas) {
+        return;
+    }
+
+    int glyph = (uint8_t)c - SMOOTH_FONT_FIRST;
+    if (glyph < 0 || glyph >= SMOOTH_FONT_GLYPHS) {
+        glyph = 0;
+    }
+    ClipRect rect = {glyph * face_width[face], 0, face_width[face], face_height[face]};
+    Graphics::blit(atlas, &rect, x, y, BLIT_OPAQUE);
+}
+
+
+void SmoothFont::draw_text(FontFace face, int x, int y, const char* text, uint8_t fg, uint8_t bg) {
+    const Surface* atlas = get_atlas(face, fg, bg);
+    if (!atlas) {
+        return;
+    }
+
+    const int width = face_width[face];
+    const int height = face_height[face];
+    int cx = x;
+    for (; *text; text++) {
+        if (*text == '\n') {
+            cx = x;
+            y += height;
+            continue;
+        }
+
+        int glyph = (uint8_t)*text - SMOOTH_FONT_FIRST;
+        if (glyph < 0 || glyph >= SMOOTH_FONT_GLYPHS) {
+            glyph = 0;
+        }
+        ClipRect rect = {glyph * width, 0, width, height};
+        Graphics::blit(atlas, &rect, cx, y, BLIT_OPAQUE);
+        cx += width;
+    }
+}
+
+
+void SmoothFont::measure_text(FontFace face, const char* text, int* width, int* height) {
+    int widest = 0;
+    int lines = 1;
+    int current = 0;
+    for (; *text; text++) {
+        if (*text == '\n') {
+            lines++;
+            current = 0;
+        } else {
+            current += face_width[face];
+            if (current > widest) widest = current;
+        }
+    }
+
+    if (width) *width = widest;
+    if (height) *height = lines * face_height[face];
+}
@@ -0,0 +1,125 @@
+#include "span_kernels.h"
+
+
+// The kernel is built without SSE, so the SSE2 kernels opt in per function;
+// that is also what lets their asm name the xmm registers it clobbers.
+#define SSE2_KERNEL __attribute__((target("sse2")))
+
+static void fill_generic(uint8_t* dest, uint8_t color, uint32_t count) {
+    while (count && ((uintptr_t)dest & 3)) {
+        *dest++ = color;
+        count--;
+    }
+
+    uint32_t pattern = color * 0x01010101u;
+    uint32_t dwords = count >> 2;
+    asm volatile("cld; rep stosl" : "+D"(dest), "+c"(dwords) : "a"(pattern) : "memory");
+
+    count &= 3;
+    while (count--) {
+        *dest++ = color;
+    }
+}
+
+
+static void copy_generic(uint8_t* dest, const uint8_t* src, uint32_t count) {
+    uint32_t dwords = count >> 2;
+    uint32_t bytes = count & 3;
+    asm volatile("cld; rep movsl" : "+D"(dest), "+S"(src), "+c"(dwords) : : "memory");
+    asm volatile("rep movsb" : "+D"(dest), "+S"(src), "+c"(bytes) : : "memory");
+}
+
+
+static void copy_keyed_generic(uint8_t* dest, const uint8_t* src, uint32_t count, uint8_t key) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (src[i] != key) {
+            dest[i] = src[i];
+        }
+    }
+}
+
+
+static void remap_generic(uint8_t* dest, uint32_t count, const uint8_t* table) {
+    while (count >= 4) {
+        dest[0] = table[dest[0]];
+        dest[1] = table[dest[1]];
+        dest[2] = table[dest[2]];
+        dest[3] = table[dest[3]];
+        dest += 4;
+        count -= 4;
+    }
+    while (count--) {
+        *dest = table[*dest];
+        dest++;
+    }
+}
+
+SSE2_KERNEL static void copy_keyed_sse2(uint8_t* dest, const uint8_t* src, uint32_t count, uint8_t key) {
+    uint32_t blocks = count >> 4;
+    if (blocks) {
+        
+        uint32_t pattern = key * 0x01010101u;
+        asm volatile(
+            "movd %3, %%xmm7\n\t"
+            "pshufd $0, %%xmm7, %%xmm7\n"
+            "1:\n\t"
+            "movdqu (%1), %%xmm0\n\t"
+            "movdqu (%0), %%xmm1\n\t"
+            "movdqa %%xmm0, %%xmm2\n\t"
+            "pcmpeqb %%xmm7, %%xmm2\n\t"
+            "pand %%xmm2, %%xmm1\n\t"
+            "pandn %%xmm0, %%xmm2\n\t"
+            "por %%xmm1, %%xmm2\n\t"
+            "movdqu %%xmm2, (%0)\n\t"
+            "add $16, %1\n\t"
+            "add $16, %0\n\t"
+            "dec %2\n\t"
+            "jnz 1b"
+            : "+r"(dest), "+r"(src), "+r"(blocks)
+            : "r"(pattern)
+            : "memory", "xmm0", "xmm1", "xmm2", "xmm7");
+    }
+
+    copy_keyed_generic(dest, src, count & 15, key);
+}
+
+SpanKernelTable SpanKernels::table = {
+    fill_generic, copy_generic, copy_keyed_generic, remap_generic, "REP MOVSD"
+};
+
+bool SpanKernels::enable_sse() {
+    uint32_t eax, ebx, ecx, edx;
+    asm volatile("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(0));
+    if (eax < 1) {
+        return false;
+    }
+
+    
+    asm volatile("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(1));
+    const uint32_t required = (1u << 24) | (1u << 25) | (1u << 26);
+    if ((edx & required) != required) {
+        return false;
+    }
+
+    
+    uintptr_t cr0, cr4;
+    asm volatile("mov %%cr0, %0" : "=r"(cr0));
+    cr0 = (cr0 & ~(uintptr_t)(1u << 2)) | (1u << 1);
+    asm volatile("mov %0, %%cr0" : : "r"(cr0));
+    asm volatile("mov %%cr4, %0" : "=r"(cr4));
+    cr4 |= (1u << 9) | (1u << 10);
+    asm volatile("mov %0, %%cr4" : : "r"(cr4));
+    asm volatile("fninit");
+    return true;
+}
+
+
+void SpanKernels::select(bool sse2) {
+    // REP STOSD/MOVSD already move whole lines at full speed; SSE2 only pays
+    // off for the keyed copy, where it replaces a byte-at-a-time loop.
+    table.fill = fill_generic;
+    table.copy = copy_generic;
+    table.copy_keyed = sse2 ? copy_keyed_sse2 : copy_keyed_generic;
+    table.remap = remap_generic;
+    table.name = sse2 ? "SSE2 keyed" : "REP MOVSD";
+}
@@ -0,0 +1,193 @@
+#include "text_layout.h"
+#include "graphics.h"
+#include "string.h"
+
+
+uint8_t TextLayout::glyph_left[256];
+uint8_t TextLayout::glyph_advance[256];
+bool TextLayout::metrics_ready = false;
+TextLayoutEntry TextLayout::entries[LAYOUT_CACHE_ENTRIES];
+uint32_t TextLayout::use_clock = 0;
+
+void TextLayout::build_metrics() {
+    for (int c = 0; c < 256; c++) {
+        const uint8_t* rows = Graphics::get_glyph((char)c);
+        uint8_t ink = 0;
+        for (int row = 0; row < FONT_HEIGHT; row++) {
+            ink |= rows[row];
+        }
+
+        if (!ink) {
+            glyph_left[c] = 0;
+            glyph_advance[c] = LAYOUT_SPACE_WIDTH;
+            continue;
+        }
+
+        int left = 0;
+        while (!(ink & (0x80 >> left))) {
+            left++;
+        }
+        int right = 7;
+        while (!(ink & (0x80 >> right))) {
+            right--;
+        }
+        glyph_left[c] = (uint8_t)left;
+        glyph_advance[c] = (uint8_t)(right - left + 2);
+    }
+    metrics_ready = true;
+}
+
+
+int TextLayout::char_width(char c) {
+    if (!metrics_ready) {
+        build_metrics();
+    }
+    return glyph_advance[(uint8_t)c];
+}
+
+
+int TextLayout::measure(const char* text, int length) {
+    int width = 0;
+    for (int i = 0; i < length && text[i]; i++) {
+        width += char_width(text[i]);
+    }
+    return width;
+}
+
+
+void TextLayout::wrap(TextLayoutEntry* entry, const char* text) {
+    TextLine* lines = entry->lines;
+    uint16_t* glyph_x = entry->glyph_x;
+    int count = 0;
+    int line_start = 0;
+    int last_space = -1;
+    int x = 0;
+
+    for (int i = 0; i <= entry->length && count < LAYOUT_MAX_LINES; i++) {
+        char c = i < entry->length ? text[i] : '\n';
+        if (c == '\n') {
+            lines[count].start = (uint16_t)line_start;
+            lines[count].length = (uint16_t)(i - line_start);
+            lines[count].width = (uint16_t)x;
+            count++;
+            line_start = i + 1;
+            last_space = -1;
+            x = 0;
+            continue;
+        }
+
+        int advance = glyph_advance[(uint8_t)c];
+        if (x + advance > entry->width && i > line_start) {
+            
+            int end = c == ' ' ? i : last_space > line_start ? last_space : i;
+            lines[count].start = (uint16_t)line_start;
+            lines[count].length = (uint16_t)(end - line_start);
+            lines[count].width = (uint16_t)(end < i ? glyph_x[end] : x);
+            count++;
+            if (count == LAYOUT_MAX_LINES) {
+                break;
+            }
+
+            line_start = end < i || c == ' ' ? end + 1 : i;
+            last_space = -1;
+            x = 0;
+            for (int k = line_start; k < i; k++) {
+                glyph_x[k] = (uint16_t)x;
+                x += glyph_advance[(uint8_t)text[k]];
+            }
+            if (c == ' ' && line_start > i) {
+                continue;
+            }
+        }
+
+        if (c == ' ') {
+            last_space = i;
+        }
+        glyph_x[i] = (uint16_t)x;
+        x += advance;
+    }
+    entry->line_count = count;
+}
+
+
+const TextLayoutEntry* TextLayout::layout(const char* text, int length, int width) {
+    if (!metrics_ready) {
+        build_metrics();
+    }
+    // Longer text would come back silently cut short; callers split it.
+    if (length < 0 || length > LAYOUT_MAX_CHARS) {
+        return nullptr;
+    }
+
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)text[i]) * 16777619u;
+    }
+
+    use_clock++;
+    TextLayoutEntry* victim = &entries[0];
+    for (int i = 0; i < LAYOUT_CACHE_ENTRIES; i++) {
+        TextLayoutEntry* entry = &entries[i];
+        if (entry->valid && entry->hash == hash && entry->length == length && entry->width == width &&
+            memcmp(entry->text, text, length) == 0) {
+            entry->last_used = use_clock;
+            return entry;
+        }
+        if (entry->last_used < victim->last_used) {
+            victim = entry;
+        }
+    }
+
+    
+    // One block per slot, so a failed allocation leaves nothing behind in
+    // the pool for the next miss to leak again.
+    if (!victim->lines) {
+        uint8_t* block = Graphics::pool_alloc(LAYOUT_MAX_LINES * sizeof(TextLine) +
+                                              LAYOUT_MAX_CHARS * sizeof(uint16_t) + LAYOUT_MAX_CHARS);
+        if (!block) {
+            return nullptr;
+        }
+        victim->lines = (TextLine*)block;
+        victim->glyph_x = (uint16_t*)(block + LAYOUT_MAX_LINES * sizeof(TextLine));
+        victim->text = (char*)(block + LAYOUT_MAX_LINES * sizeof(TextLine) + LAYOUT_MAX_CHARS * sizeof(uint16_t));
+    }
+
+    victim->hash = hash;
+    victim->length = length;
+    victim->width = width;
+    victim->last_used = use_clock;
+    victim->valid = true;
+    memcpy(victim->text, text, length);
+    wrap(victim, text);
+    return victim;
+}
+
+void TextLayout::draw_line(const TextLayoutEntry* entry, const char* text, int line, int x, int y,
+                           uint8_t color) {
+    if (!entry || line < 0 || line >= entry->line_count) {
+        return;
+    }
+
+    const TextLine& span = entry->lines[line];
+    for (int i = span.start; i < span.start + span.length; i++) {
+        uint8_t c = (uint8_t)text[i];
+        if (c != ' ') {
+            Graphics::draw_char(x + entry->glyph_x[i] - glyph_left[c], y, (char)c, color);
+        }
+    }
+}
+
+
+void TextLayout::draw_text(int x, int y, const char* text, uint8_t color) {
+    if (!metrics_ready) {
+        build_metrics();
+    }
+
+    for (; *text; text++) {
+        uint8_t c = (uint8_t)*text;
+        if (c != ' ') {
+            Graphics::draw_char(x - glyph_left[c], y, (char)c, color);
+        }
+        x += glyph_advance[c];
+    }
+}
@@ -12,17 +12,16 @@ void GUI::draw_button(const Button* btn, uint8_t color) {
 
     
     if (btn->pressed) {
-        for (int y = 1; y < btn->height - 1; y++) {
-            for (int x = 1; x < btn->width - 1; x++) {
-                Graphics::put_pixel(btn->x + x, btn->y + y, 8); 
-            }
-        }
+        Graphics::draw_rect(btn->x + 1, btn->y + 1, btn->width - 2, btn->height - 2, 8);
     }
 
     
-    int text_x = btn->x + (btn->width / 2) - ((strlen(btn->text) * 8) / 2);
-    int text_y = btn->y + (btn->height / 2) - 4;
-    Graphics::draw_text(text_x, text_y, btn->text, color);
+    int text_width, text_height;
+    Graphics::measure_text(btn->text, &text_width, &text_height);
+    int text_x = btn->x + (btn->width / 2) - (text_width / 2);
+    int text_y = btn->y + (btn->height / 2) - (text_height / 2);
+    const ClipRect clip = {btn->x, btn->y, btn->width, btn->height};
+    Graphics::draw_text_clipped(text_x, text_y, btn->text, color, &clip);
 }
 
 bool GUI::is_button_clicked(const Button* btn, const MouseState* mouse) {
@@ -36,14 +35,7 @@ void GUI::draw_dialog(const Dialog* dlg, uint8_t bg_color, uint8_t border_color)
     Graphics::draw_rect(dlg->x, dlg->y, dlg->width, dlg->height, bg_color);
 
     
-    for (int x = dlg->x; x < dlg->x + dlg->width; x++) {
-        Graphics::put_pixel(x, dlg->y, border_color);
-        Graphics::put_pixel(x, dlg->y + dlg->height - 1, border_color);
-    }
-    for (int y = dlg->y; y < dlg->y + dlg->height; y++) {
-        Graphics::put_pixel(dlg->x, y, border_color);
-        Graphics::put_pixel(dlg->x + dlg->width - 1, y, border_color);
-    }
+    Graphics::draw_outline(dlg->x, dlg->y, dlg->width, dlg->height, border_color);
 
     
     if (dlg->title) {
@@ -86,71 +78,28 @@ int GUI::get_clicked_file_index(int x, int y, int width, int entry_height, const
     return relative_y / entry_height;
 }
 
+static const uint8_t plus_icon[ICON_SIZE] = {0x00, 0x10, 0x10, 0x7C, 0x10, 0x10, 0x00, 0x00};
+static const uint8_t trash_icon[ICON_SIZE] = {0x00, 0x7C, 0x28, 0x28, 0x28, 0x28, 0x38, 0x00};
+static const uint8_t back_arrow_icon[ICON_SIZE] = {0x00, 0x00, 0x20, 0x7C, 0x20, 0x00, 0x00, 0x00};
+static const uint8_t folder_icon[ICON_SIZE] = {0xE0, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00};
+static const uint8_t file_icon[ICON_SIZE] = {0xFC, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xFC};
+
 void GUI::draw_plus_icon(int x, int y, uint8_t color) {
-    
-    
-    for (int i = 1; i < 6; i++) {
-        Graphics::put_pixel(x + 3, y + i, color);
-    }
-    
-    for (int i = 1; i < 6; i++) {
-        Graphics::put_pixel(x + i, y + 3, color);
-    }
+    Graphics::draw_icon(x, y, plus_icon, ICON_SIZE, color);
 }
 
 void GUI::draw_trash_icon(int x, int y, uint8_t color) {
-    
-    
-    for (int i = 1; i < 6; i++) {
-        Graphics::put_pixel(x + i, y + 1, color);
-    }
-    
-    Graphics::put_pixel(x + 2, y + 2, color);
-    Graphics::put_pixel(x + 4, y + 2, color);
-    for (int j = 3; j < 6; j++) {
-        Graphics::put_pixel(x + 2, y + j, color);
-        Graphics::put_pixel(x + 4, y + j, color);
-    }
-    
-    for (int i = 2; i < 5; i++) {
-        Graphics::put_pixel(x + i, y + 6, color);
-    }
+    Graphics::draw_icon(x, y, trash_icon, ICON_SIZE, color);
 }
 
 void GUI::draw_back_arrow(int x, int y, uint8_t color) {
-    
-    
-    Graphics::put_pixel(x + 1, y + 3, color);
-    Graphics::put_pixel(x + 2, y + 2, color);
-    Graphics::put_pixel(x + 2, y + 4, color);
-    
-    for (int i = 2; i < 6; i++) {
-        Graphics::put_pixel(x + i, y + 3, color);
-    }
+    Graphics::draw_icon(x, y, back_arrow_icon, ICON_SIZE, color);
 }
 
 void GUI::draw_folder_icon(int x, int y, uint8_t color) {
-    
-    
-    Graphics::put_pixel(x, y, color);
-    Graphics::put_pixel(x + 1, y, color);
-    Graphics::put_pixel(x + 2, y, color);
-    
-    for (int j = 1; j < 6; j++) {
-        for (int i = 0; i < 7; i++) {
-            Graphics::put_pixel(x + i, y + j, color);
-        }
-    }
+    Graphics::draw_icon(x, y, folder_icon, ICON_SIZE, color);
 }
 
 void GUI::draw_file_icon(int x, int y, uint8_t color) {
-    
-    for (int j = 0; j < 8; j++) {
-        Graphics::put_pixel(x, y + j, color);
-        Graphics::put_pixel(x + 5, y + j, color);
-    }
-    for (int i = 0; i < 6; i++) {
-        Graphics::put_pixel(x + i, y, color);
-        Graphics::put_pixel(x + i, y + 7, color);
-    }
+    Graphics::draw_icon(x, y, file_icon, ICON_SIZE, color);
 }
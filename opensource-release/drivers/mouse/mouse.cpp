@@ -28,6 +28,8 @@ bool Mouse::click_consumed[3] = {false, false, false};
 uint8_t Mouse::button_stability[3] = {0, 0, 0};
 uint8_t Mouse::resync_attempts = 0;
 uint16_t Mouse::packets_processed = 0;
+int Mouse::bound_width = 320;
+int Mouse::bound_height = 200;
 
 
 static void wait_input() {
@@ -338,9 +340,9 @@ void Mouse::handle_packet(uint8_t byte) {
 
         
         if (state.x < 0) state.x = 0;
-        if (state.x >= 320) state.x = 319;
+        if (state.x >= bound_width) state.x = bound_width - 1;
         if (state.y < 0) state.y = 0;
-        if (state.y >= 200) state.y = 199;
+        if (state.y >= bound_height) state.y = bound_height - 1;
 
         packet_index = 0;
 
@@ -402,6 +404,13 @@ MouseState Mouse::get_state() {
     return state;
 }
 
+void Mouse::set_bounds(int width, int height) {
+    bound_width = width;
+    bound_height = height;
+    if (state.x >= width) state.x = width - 1;
+    if (state.y >= height) state.y = height - 1;
+}
+
 bool Mouse::is_button_pressed(uint8_t button) {
     switch (button) {
         case 0: return state.left_button;
@@ -432,17 +441,12 @@ bool Mouse::was_button_clicked(uint8_t button) {
     return false;
 }
 
+static const uint8_t cursor_icon[5] = {0x80, 0xC0, 0xE0, 0xE0, 0xE0};
+
 void Mouse::draw_cursor(uint8_t color) {
     if (!initialized) return;
 
-    
-    for (int dy = 0; dy < 5; dy++) {
-        for (int dx = 0; dx < 3; dx++) {
-            if (dx <= dy) {
-                Graphics::put_pixel(state.x + dx, state.y + dy, color);
-            }
-        }
-    }
+    Graphics::draw_icon(state.x, state.y, cursor_icon, 5, color);
 }
 
 // FIXME (upcoming in new update)
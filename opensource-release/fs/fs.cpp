@@ -91,7 +91,7 @@ namespace FileSystem {
 
         
         create_file("HELP.TXT", EXT_TXT);
-        write_file("HELP.TXT", "QUICKS Shell v1.0\nCommand Reference\n\nSYSTEM COMMANDS:\nhelp - Show this help\nclear - Clear screen\nversion - System version\nuname - System info\nwhoami - Current user\nstatus - HW status\nabout - About OS\ndu - Disk usage\nhistory - Cmd history\n\nFILE COMMANDS:\nls - List files\ncd <dir> - Change dir\nmkdir <name> - New dir\ntouch <file> - New file\ncat <file> - View file\nrm <file> - Delete file\nrmdir <dir> - Del empty dir\nmv <old> <new> - Rename\ncp <src> <dst> - Copy\ntree - Dir tree\nfind <pat> - Search\n\nCOMPILER:\ncompile <file> - REAL x86\n  .c .cpp = C compiler\n  .asm = x86 assembler\nrun <file> - Execute .bin\nrun snake - Snake game\n\nC BUILT-INS:\nprint(str) printnum(n)\nputchar(c) return n\nint if/else while for\n\nASM: mov add sub cmp\njmp je jne call ret\npush pop xor inc dec\n\nHOTKEYS:\nF1=Help F2=New F3=Edit\nF5=Build Del=Delete\nESC=Back Arrows=Nav\n\nFUN:\nbanner neofetch cowsay\nfortune old.ai");
+        write_file("HELP.TXT", "QUICKS Shell v1.0\nCommand Reference\n\nSYSTEM COMMANDS:\nhelp - Show this help\nclear - Clear screen\nversion - System version\nuname - System info\nwhoami - Current user\nstatus - HW status\nabout - About OS\ndu - Disk usage\nhistory - Cmd history\ngfxbench - Draw speed\nfps [hz] - Frame rate\nvsync on|off - Tearing\nvmode 13h|x|x240 - Video\nvmode WxHxB - VBE mode\n\nFILE COMMANDS:\nls - List files\ncd <dir> - Change dir\nmkdir <name> - New dir\ntouch <file> - New file\ncat <file> - View file\nrm <file> - Delete file\nrmdir <dir> - Del empty dir\nmv <old> <new> - Rename\ncp <src> <dst> - Copy\ntree - Dir tree\nfind <pat> - Search\nview <file> - FAT12 BMP\nview - Back to face\n\nCOMPILER:\ncompile <file> - REAL x86\n  .c .cpp = C compiler\n  .asm = x86 assembler\nrun <file> - Execute .bin\nrun snake - Snake game\n\nC BUILT-INS:\nprint(str) printnum(n)\nputchar(c) return n\nint if/else while for\n\nASM: mov add sub cmp\njmp je jne call ret\npush pop xor inc dec\n\nHOTKEYS:\nF1=Help F2=New F3=Edit\nF5=Build Del=Delete\nESC=Back Arrows=Nav\n\nFUN:\nbanner neofetch cowsay\nfortune old.ai");
 
         // Note: This help text defines the intended system specification.
         // While the compiler and certain binary execution features are currently stubs in the OSS version,
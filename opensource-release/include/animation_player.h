@@ -0,0 +1,38 @@
+#ifndef ANIMATION_PLAYER_H
+#define ANIMATION_PLAYER_H
+
+#include "types.h"
+#include "graphics.h"
+#include "asset_cache.h"
+
+
+#define ANIMATION_FPS_DEFAULT 12
+
+class AnimationPlayer {
+public:
+    static bool start(AnimationId id, int x, int y, uint8_t rate);
+    static void stop();
+    static void set_paused(bool state) { paused = state; }
+
+    
+    static bool is_active() { return animation && !paused; }
+    static bool is_due(uint32_t now_ms);
+    static void step(uint32_t now_ms);
+    static bool draw();
+
+private:
+    static bool apply_delta(int* top, int* bottom);
+
+    static const PackedAnimation* animation;
+    static Surface frame;
+    static int origin_x;
+    static int origin_y;
+    static uint32_t offset;
+    static uint8_t frame_index;
+    static uint8_t fps;
+    static uint32_t next_frame_ms;
+    static bool scheduled;
+    static bool paused;
+};
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include "types.h"
+#include "graphics.h"
+
+
+enum AssetId {
+    ASSET_SCP079_FACE,
+    ASSET_SCP079_FACE2,
+    ASSET_COUNT
+};
+
+enum AnimationId {
+    ANIMATION_SCP079_FACE_SCAN,
+    ANIMATION_COUNT
+};
+
+struct PackedImage {
+    uint16_t width;
+    uint16_t height;
+    uint32_t size;
+    const uint8_t* data;
+};
+
+struct PackedAnimation {
+    AssetId keyframe;
+    uint8_t frame_count;
+    const uint8_t* deltas;
+};
+
+
+extern const PackedImage packed_assets[ASSET_COUNT];
+extern const PackedAnimation packed_animations[ANIMATION_COUNT];
+
+class AssetCache {
+public:
+    static bool get(AssetId id, Surface* image);
+
+private:
+    static bool decode(const PackedImage* packed, uint8_t* pixels);
+
+    static uint8_t* pixels[ASSET_COUNT];
+};
+
+#endif
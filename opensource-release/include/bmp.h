@@ -2,6 +2,15 @@
 #define BMP_H
 
 #include "types.h"
+#include "image_scaler.h"
+
+
+#define BMP_MAX_PIXELS (SCREEN_WIDTH * SCREEN_HEIGHT)
+#define BMP_PREAMBLE_SIZE (14 + 124 + 256 * 4)
+#define BMP_RGB 0
+#define BMP_RLE8 1
+#define BMP_RLE4 2
+#define BMP_BITFIELDS 3
 
 
 #pragma pack(push, 1)
@@ -38,15 +47,25 @@ struct RGBQuad {
 class BMP {
 public:
     static bool load_from_memory(const uint8_t* data, uint32_t size);
+    static bool load_from_file(const char* filename, Surface* target = nullptr);
     static void draw(int x, int y);
+    static void draw_scaled(int x, int y, int width, int height, ScaleFilter filter);
     static void free();
 
 private:
     static BMPHeader header;
     static BMPInfoHeader info;
     static uint8_t* image_data;
+    static int image_pitch;
     static RGBQuad* palette;
     static bool loaded;
+
+    static void wrap(Surface* image);
+    static bool read_headers(const uint8_t* data);
+    static bool read_color_table(const uint8_t* data, uint32_t size, uint8_t* remap);
+    static bool decode_rows(const uint8_t* pixels, uint32_t stride, const uint8_t* remap);
+    static bool decode_rle(const uint8_t* src, uint32_t length, int bits, const uint8_t* remap);
+    static void convert_row(const uint8_t* src, uint8_t* out, int y, const uint8_t* remap);
 };
 
 #endif
@@ -0,0 +1,60 @@
+#ifndef BOCHS_VBE_H
+#define BOCHS_VBE_H
+
+#include "types.h"
+
+
+#define VBE_DISPI_IOPORT_INDEX 0x01CE
+#define VBE_DISPI_IOPORT_DATA  0x01CF
+
+#define VBE_DISPI_INDEX_ID          0x0
+#define VBE_DISPI_INDEX_XRES        0x1
+#define VBE_DISPI_INDEX_YRES        0x2
+#define VBE_DISPI_INDEX_BPP         0x3
+#define VBE_DISPI_INDEX_ENABLE      0x4
+#define VBE_DISPI_INDEX_BANK        0x5
+#define VBE_DISPI_INDEX_VIRT_WIDTH  0x6
+#define VBE_DISPI_INDEX_VIRT_HEIGHT 0x7
+#define VBE_DISPI_INDEX_X_OFFSET    0x8
+#define VBE_DISPI_INDEX_Y_OFFSET    0x9
+
+#define VBE_DISPI_ID0 0xB0C0
+#define VBE_DISPI_ID5 0xB0C5
+
+#define VBE_DISPI_DISABLED    0x00
+#define VBE_DISPI_ENABLED     0x01
+#define VBE_DISPI_LFB_ENABLED 0x40
+#define VBE_DISPI_NOCLEARMEM  0x80
+
+
+#define VBE_DISPI_LFB_DEFAULT 0xE0000000
+
+class BochsVBE {
+public:
+    static bool detect();
+    static bool set_mode(uint16_t width, uint16_t height, uint8_t bpp);
+    static void disable();
+
+    static bool is_available() { return available; }
+    static bool is_enabled() { return enabled; }
+    static uint8_t* get_framebuffer() { return framebuffer; }
+    static uint16_t get_width() { return width; }
+    static uint16_t get_height() { return height; }
+    static uint8_t get_bpp() { return bpp; }
+    static uint32_t get_pitch() { return pitch; }
+
+private:
+    static void write_register(uint16_t index, uint16_t value);
+    static uint16_t read_register(uint16_t index);
+    static uint32_t find_framebuffer();
+
+    static bool available;
+    static bool enabled;
+    static uint8_t* framebuffer;
+    static uint16_t width;
+    static uint16_t height;
+    static uint8_t bpp;
+    static uint32_t pitch;
+};
+
+#endif
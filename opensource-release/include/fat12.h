@@ -39,6 +39,16 @@ struct __attribute__((packed)) FAT12DirectoryEntry {
 };
 
 
+struct FAT12Cursor {
+    uint16_t cluster;              
+    uint32_t file_size;
+    uint32_t position;             
+    uint32_t buffered;             
+    uint32_t offset;               
+    uint8_t  buffer[4096];
+};
+
+
 #define FAT12_ATTR_READ_ONLY  0x01
 #define FAT12_ATTR_HIDDEN     0x02
 #define FAT12_ATTR_SYSTEM     0x04
@@ -52,6 +62,8 @@ public:
     static void initialize();
     static bool mount();
     static bool read_file(const char* filename, uint8_t* buffer, uint32_t max_size, uint32_t* bytes_read);
+    static bool open_file(const char* filename, FAT12Cursor* cursor);
+    static uint32_t read_cursor(FAT12Cursor* cursor, uint8_t* buffer, uint32_t count);
     static bool write_file(const char* filename, const uint8_t* buffer, uint32_t size);
     static bool create_file(const char* filename);
     static bool create_directory(const char* dirname);
@@ -0,0 +1,38 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include "types.h"
+
+
+#define FRAME_RATE_DEFAULT 70
+#define FRAME_RATE_MIN 10
+#define FRAME_RATE_MAX 240
+#define PIT_TICK_MS 55
+
+class FramePacer {
+public:
+    static void initialize(uint16_t target_hz);
+    static void set_target_rate(uint16_t hz);
+    static uint16_t get_target_rate() { return target_rate; }
+
+    
+    static bool tick(uint32_t pit_ticks);
+    static uint32_t get_time_ms() { return clock_ms; }
+
+    static uint32_t get_frames_presented() { return frames_presented; }
+    static bool is_calibrated() { return cycles_per_ms != 0; }
+
+private:
+    static bool calibrate();
+    static void update_clock(uint32_t pit_ticks);
+
+    static uint16_t target_rate;
+    static uint32_t cycles_per_ms;
+    static uint32_t cycles_per_frame;
+    static uint64_t last_present;
+    static uint32_t frames_presented;
+    static uint64_t clock_tsc;
+    static uint32_t clock_ms;
+};
+
+#endif
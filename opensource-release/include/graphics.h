@@ -7,25 +7,216 @@
 #define SCREEN_WIDTH 320
 #define SCREEN_HEIGHT 200
 
+#define LFB_MAX_WIDTH 1600
+#define CANVAS_MAX_WIDTH 1024
+#define CANVAS_MAX_HEIGHT 768
+
+#define MODEX_ROW_BYTES (SCREEN_WIDTH / 4)
+#define MODEX_MAX_PAGES 4
+#define MODEX_MAX_HEIGHT 240
+
+#define FONT_WIDTH 8
+#define FONT_HEIGHT 8
+#define FONT_SMALL_WIDTH 4
+#define FONT_SMALL_HEIGHT 6
+
+#define SURFACE_CLIP_DEPTH 8
+#define GRAPHICS_POOL_BASE 0x100000
+#define GRAPHICS_POOL_SIZE 0x280000
+
+#define BLIT_OPAQUE -1
+#define ICON_SIZE 8
+#define OVERLAY_MAX_SIZE 16
+
+
+enum VideoMode {
+    VIDEO_MODE_TEXT,
+    VIDEO_MODE_13H,
+    VIDEO_MODE_X,
+    VIDEO_MODE_LFB
+};
+
+
+enum PresentMode {
+    PRESENT_IMMEDIATE,
+    PRESENT_VSYNC
+};
+
+
+enum BlendLevel {
+    BLEND_QUARTER,
+    BLEND_HALF,
+    BLEND_THREE_QUARTERS,
+    BLEND_LEVEL_COUNT
+};
+
+
+enum PixelFormat {
+    PIXEL_FORMAT_INDEXED8,
+    PIXEL_FORMAT_XRGB32
+};
+
+
+struct Point {
+    int16_t x, y;
+};
+
+
+struct ClipRect {
+    int x, y;
+    int width, height;
+};
+
+
+struct Surface {
+    uint8_t* pixels;
+    int pitch;
+    int width, height;
+    PixelFormat format;
+    int origin_x, origin_y;
+    ClipRect clip_stack[SURFACE_CLIP_DEPTH];
+    int clip_depth;
+};
+
 class Graphics {
 public:
-    static void initialize();
+    static void initialize(uint32_t memory_end);
     static void set_mode_text();
     static void set_mode_graphics();
+    static void set_mode_x(int height);
+    static bool set_mode_lfb(uint16_t width, uint16_t height, uint8_t bpp);
+    static VideoMode get_video_mode() { return video_mode; }
+    static int get_page_count() { return page_count; }
+    static int get_display_width() { return display_width; }
+    static int get_display_height() { return display_height; }
+    static int get_width() { return screen.width; }
+    static int get_height() { return screen.height; }
+    
+    static Surface* get_screen() { return &screen; }
+    static Surface* get_target() { return target; }
+    static void set_target(Surface* surface);
+    static uint8_t* pool_alloc(uint32_t size);
+    static bool create_surface(Surface* surface, int x, int y, int width, int height);
+    static void wrap_surface(Surface* surface, uint8_t* pixels, int width, int height);
+    static void push_clip(int x, int y, int width, int height);
+    static void pop_clip();
+    static void blit_surface(const Surface* source);
+    static void blit(const Surface* source, const ClipRect* rect, int x, int y, int colorkey);
+    static void save_under(Surface* store, int x, int y);
+    static void restore_under(const Surface* store);
+    static void blend_blit(const Surface* source, const ClipRect* rect, int x, int y, int colorkey,
+                           BlendLevel level);
+    static void blend_rect(int x, int y, int width, int height, uint8_t color, BlendLevel level);
+
     static void put_pixel(int x, int y, uint8_t color);
     static uint8_t get_pixel(int x, int y);
     static void draw_rect(int x, int y, int width, int height, uint8_t color);
     static void clear_screen(uint8_t color);
+    static void scroll_region(int x, int y, int width, int height, int dy, uint8_t fill);
+    static void draw_hline(int x, int y, int length, uint8_t color);
+    static void draw_vline(int x, int y, int length, uint8_t color);
+    static void draw_outline(int x, int y, int width, int height, uint8_t color);
+    static void draw_line(int x0, int y0, int x1, int y1, uint8_t color);
+    static void draw_circle(int cx, int cy, int radius, uint8_t color);
+    static void fill_circle(int cx, int cy, int radius, uint8_t color);
+    static void fill_polygon(const Point* points, int count, uint8_t color);
     static void set_palette(uint8_t index, uint8_t r, uint8_t g, uint8_t b);
+    static void set_palette_range(uint8_t first, int count, const uint8_t* rgb);
+    static const uint8_t* get_palette() { return palette_shadow; }
+    static void load_palette(uint8_t first, int count, const uint8_t* rgb);
+    static uint8_t nearest_color(uint8_t r, uint8_t g, uint8_t b);
+    static bool prepare_inverse_palette();
+    static uint8_t nearest_rgb555(uint16_t key);
+    static uint32_t get_palette_generation() { return palette_generation; }
     static void draw_char(int x, int y, char c, uint8_t color);
     static void draw_char_small(int x, int y, char c, uint8_t color);
     static void draw_text(int x, int y, const char* text, uint8_t color);
     static void draw_text_small(int x, int y, const char* text, uint8_t color);
+    static void draw_text_clipped(int x, int y, const char* text, uint8_t color, const ClipRect* clip);
+    static void draw_text_run(int x, int y, const char* text, int length, uint8_t color, const ClipRect* clip);
+    static void draw_text_run_small(int x, int y, const char* text, int length, uint8_t color, const ClipRect* clip);
+    static void measure_text(const char* text, int* width, int* height);
+    static void measure_text_small(const char* text, int* width, int* height);
+    static const uint8_t* get_glyph(char c);
     static void draw_image(int x, int y, int width, int height, const uint8_t* data);
+    static void draw_icon(int x, int y, const uint8_t* rows, int height, uint8_t color);
+
+    
+    static void set_overlay(const Surface* sprite, int colorkey);
+    static void move_overlay(int x, int y);
+    static void hide_overlay();
+
+    
+    static void mark_dirty(int x, int y, int width, int height);
+    static bool has_damage() { return dirty_top < dirty_bottom; }
+    static void present();
+    static void set_present_mode(PresentMode mode);
+    static PresentMode get_present_mode() { return present_mode; }
+    static void wait_vertical_retrace();
+    static void poll_retrace();
 
 private:
+    static void draw_run(int x, int y, const char* text, int length, uint8_t color,
+                         const ClipRect* clip, bool small);
+    static void measure(const char* text, int advance, int line_height, int* width, int* height);
+    static void set_canvas(uint8_t* pixels, int width, int height);
+    static void present_planar();
+    static void present_lfb();
+    static void fill_hspan(int x0, int x1, int y, uint8_t color);
+    static void blit_rows(const Surface* source, const ClipRect* rect, int x, int y, int colorkey,
+                          const uint8_t* table);
+    static const uint8_t* get_blend_table(BlendLevel level);
+    static void build_inverse_palette();
+    static uint8_t fill_rgb555(int key);
+    static void plot(int x, int y, uint8_t color);
+    static void stamp_overlay();
+    static void erase_overlay();
+    static void flip_page(int page);
+    static void touch(int x, int y, int width, int height) {
+        if (target == &screen) mark_dirty(x, y, width, height);
+    }
+
     static uint8_t* video_memory;
+    static uint8_t* back_buffer;
     static bool is_graphics_mode;
+    static VideoMode video_mode;
+    static PresentMode present_mode;
+    static uint8_t palette_shadow[256 * 3];
+    static uint32_t palette_rgb[256];
+    static uint32_t palette_generation;
+
+    
+    static Surface screen;
+    static Surface* target;
+    static Surface lfb_surface;
+
+    
+    static const Surface* overlay_sprite;
+    static int overlay_key;
+    static int overlay_x;
+    static int overlay_y;
+    static bool overlay_visible;
+    static Surface overlay_save;
+
+    
+    static int16_t dirty_x0[CANVAS_MAX_HEIGHT];
+    static int16_t dirty_x1[CANVAS_MAX_HEIGHT];
+    static int dirty_top;
+    static int dirty_bottom;
+
+    
+    static int page_count;
+    static int visible_page;
+    static int pending_page;
+    static int display_width;
+    static int display_height;
+    static int lfb_scale;
+    static int lfb_x;
+    static int lfb_y;
+    static int16_t page_dirty_x0[MODEX_MAX_PAGES][MODEX_MAX_HEIGHT];
+    static int16_t page_dirty_x1[MODEX_MAX_PAGES][MODEX_MAX_HEIGHT];
+    static int page_dirty_top[MODEX_MAX_PAGES];
+    static int page_dirty_bottom[MODEX_MAX_PAGES];
 };
 
 #endif
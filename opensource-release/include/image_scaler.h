@@ -0,0 +1,44 @@
+#ifndef IMAGE_SCALER_H
+#define IMAGE_SCALER_H
+
+#include "types.h"
+#include "graphics.h"
+
+
+#define SCALE_CACHE_SLOTS 4
+
+enum ScaleFilter {
+    SCALE_NEAREST,
+    SCALE_BILINEAR
+};
+
+struct ScaledImage {
+    const uint8_t* source_pixels;
+    int source_pitch;
+    int source_width;
+    int source_height;
+    int width;
+    int height;
+    ScaleFilter filter;
+    uint32_t generation;
+    uint32_t last_used;
+    bool valid;
+    Surface surface;
+};
+
+class ImageScaler {
+public:
+    
+    static const Surface* scale(const Surface* source, int width, int height, ScaleFilter filter);
+    static void draw(const Surface* source, int x, int y, int width, int height, ScaleFilter filter);
+    static void invalidate(const uint8_t* source_pixels);
+
+private:
+    static void build_tables(int source_size, int size, bool bilinear, int16_t* index, uint8_t* frac);
+    static void render(const Surface* source, ScaledImage* image);
+
+    static ScaledImage cache[SCALE_CACHE_SLOTS];
+    static uint32_t use_clock;
+};
+
+#endif
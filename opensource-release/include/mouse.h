@@ -19,6 +19,7 @@ public:
     static void initialize();
     static void update();
     static MouseState get_state();
+    static void set_bounds(int width, int height);
     static bool is_button_pressed(uint8_t button); 
     static bool was_button_clicked(uint8_t button);
 
@@ -53,6 +54,8 @@ private:
     static uint8_t button_stability[3];  
     static uint8_t resync_attempts;  
     static uint16_t packets_processed;  
+    static int bound_width;
+    static int bound_height;
 };
 
 #endif
@@ -0,0 +1,44 @@
+#ifndef PALETTE_ANIMATOR_H
+#define PALETTE_ANIMATOR_H
+
+#include "types.h"
+
+
+#define PALETTE_LEVEL_FULL 255
+#define PALETTE_MAX_CYCLES 4
+
+struct PaletteCycle {
+    uint8_t first;
+    uint8_t count;
+    uint8_t frames_per_step;
+    uint8_t countdown;
+    uint8_t offset;
+};
+
+class PaletteAnimator {
+public:
+    
+    static void set_level(uint8_t level);
+    static void fade_to(uint8_t level, uint16_t frames);
+    static uint8_t get_level() { return level >> 8; }
+    static bool is_fading() { return fade_frames != 0; }
+
+    
+    static bool add_cycle(uint8_t first, uint8_t count, uint8_t frames_per_step);
+    static void clear_cycles();
+
+    
+    static bool is_active() { return dirty || fade_frames != 0 || cycle_count != 0; }
+    static void step();
+
+private:
+    static int32_t level;
+    static int32_t fade_delta;
+    static int32_t fade_target;
+    static uint16_t fade_frames;
+    static PaletteCycle cycles[PALETTE_MAX_CYCLES];
+    static int cycle_count;
+    static bool dirty;
+};
+
+#endif
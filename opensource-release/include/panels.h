@@ -0,0 +1,97 @@
+#ifndef PANELS_H
+#define PANELS_H
+
+#include "types.h"
+
+
+// The desktop panels around the face: file manager, terminal, status panel
+// and the create dialog. The kernel drives them from its shell and input
+// loop; the host render test draws the same code into its golden scenes.
+
+#define MAX_LINES 100
+#define LINE_CAPACITY 80
+
+static const int fm_y = 0;
+static const int FM_TOOLBAR = 10;
+static const int fm_view_y = fm_y + FM_TOOLBAR + 3;
+static const int term_x = 0;
+static const int TERM_LINE_HEIGHT = 10;
+
+
+static const uint8_t COL_WHITE    = 255;
+static const uint8_t COL_BRIGHT   = 200;
+static const uint8_t COL_DIR      = 180;
+static const uint8_t COL_TEXT     = 150;
+static const uint8_t COL_BUTTON   = 120;
+static const uint8_t COL_LABEL    = 100;
+static const uint8_t COL_DIM      = 80;
+static const uint8_t COL_DIALOG   = 50;
+static const uint8_t COL_GREEN    = 46;
+static const uint8_t COL_TOOLBAR  = 40;
+static const uint8_t COL_SELECT   = 30;
+static const uint8_t COL_RED      = 196;
+static const uint8_t COL_BLACK    = 0;
+
+
+// Panel geometry, recomputed by layout_panels() for the current canvas.
+extern int screen_w;
+extern int screen_h;
+extern int face_scale;
+extern int split_x;
+extern int split_y;
+extern int term_right;
+extern int fm_x;
+extern int fm_w;
+extern int fm_h;
+extern int fm_view_lines;
+extern int fm_view_h;
+extern int term_y;
+extern int term_w;
+extern int term_h;
+extern int term_text_w;
+extern int term_visible_lines;
+extern int term_columns;
+extern int status_x;
+extern int status_y;
+extern int status_w;
+extern int status_h;
+
+
+extern bool fm_viewing_file;
+extern char fm_current_file[64];
+extern int fm_selected_index;
+extern int fm_file_scroll_offset;
+extern int fm_list_scroll_offset;
+extern bool file_edit_mode;
+
+extern bool dialog_active;
+extern char dialog_name_buffer[64];
+extern int dialog_name_pos;
+extern int dialog_button_index;
+
+extern int buffer_lines;
+extern int scroll_offset;
+
+
+void layout_panels();
+void place_panels();
+void composite_panels();
+void set_status_info(const char* cpu, uint32_t ram_mb);
+void draw_panel_borders();
+
+void add_line(const char* text, uint8_t color);
+void add_text(const char* text, uint8_t color);
+void clear_buffer();
+void draw_terminal();
+void redraw_terminal();
+
+void draw_file_manager();
+void redraw_file_manager();
+void scroll_file_viewer(int delta);
+
+void draw_create_dialog(bool opening = false);
+void draw_status_panel();
+void redraw_status_panel();
+void format_video_mode(char* out, int size);
+
+#endif
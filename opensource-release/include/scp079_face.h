@@ -1,11 +0,0 @@
-#ifndef SCP079_FACE_H
-#define SCP079_FACE_H
-
-#include "types.h"
-
-
-extern int SCP079_FACE_WIDTH;
-extern int SCP079_FACE_HEIGHT;
-extern uint8_t scp079_face_data[];
-
-#endif
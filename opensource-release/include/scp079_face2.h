@@ -1,11 +0,0 @@
-#ifndef SCP079_FACE2_H
-#define SCP079_FACE2_H
-
-#include "types.h"
-
-
-extern int SCP079_FACE2_WIDTH;
-extern int SCP079_FACE2_HEIGHT;
-extern uint8_t scp079_face2_data[];
-
-#endif
@@ -0,0 +1,49 @@
+#ifndef SMOOTH_FONT_H
+#define SMOOTH_FONT_H
+
+#include "types.h"
+#include "graphics.h"
+
+
+#define SMOOTH_FONT_FIRST 32
+#define SMOOTH_FONT_GLYPHS 96
+#define SMOOTH_FONT_CACHE_SLOTS 8
+
+enum FontFace {
+    FONT_FACE_6X8,
+    FONT_FACE_8X12,
+    FONT_FACE_COUNT
+};
+
+struct GlyphCacheSlot {
+    Surface atlas;
+    uint32_t generation;
+    uint32_t last_used;
+    uint8_t face;
+    uint8_t fg;
+    uint8_t bg;
+    bool valid;
+};
+
+class SmoothFont {
+public:
+    static int get_width(FontFace face);
+    static int get_height(FontFace face);
+
+    
+    static void draw_char(FontFace face, int x, int y, char c, uint8_t fg, uint8_t bg);
+    static void draw_text(FontFace face, int x, int y, const char* text, uint8_t fg, uint8_t bg);
+    static void measure_text(FontFace face, const char* text, int* width, int* height);
+
+private:
+    static void build_coverage(FontFace face);
+    static const Surface* get_atlas(FontFace face, uint8_t fg, uint8_t bg);
+
+    static uint8_t coverage_6x8[SMOOTH_FONT_GLYPHS][6 * 8 / 2];
+    static uint8_t coverage_8x12[SMOOTH_FONT_GLYPHS][8 * 12 / 2];
+    static bool coverage_ready[FONT_FACE_COUNT];
+    static GlyphCacheSlot slots[SMOOTH_FONT_CACHE_SLOTS];
+    static uint32_t use_clock;
+};
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef SPAN_KERNELS_H
+#define SPAN_KERNELS_H
+
+#include "types.h"
+
+
+struct SpanKernelTable {
+    void (*fill)(uint8_t* dest, uint8_t color, uint32_t count);
+    void (*copy)(uint8_t* dest, const uint8_t* src, uint32_t count);
+    void (*copy_keyed)(uint8_t* dest, const uint8_t* src, uint32_t count, uint8_t key);
+    void (*remap)(uint8_t* dest, uint32_t count, const uint8_t* table);
+    const char* name;
+};
+
+class SpanKernels {
+public:
+    
+    static bool enable_sse();
+    static void select(bool sse2);
+    static const char* get_name() { return table.name; }
+
+    
+    static SpanKernelTable table;
+};
+
+#endif
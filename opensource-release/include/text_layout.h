@@ -0,0 +1,53 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include "types.h"
+
+
+#define LAYOUT_CACHE_ENTRIES 8
+#define LAYOUT_MAX_LINES 256
+#define LAYOUT_MAX_CHARS 2048
+#define LAYOUT_SPACE_WIDTH 4
+
+struct TextLine {
+    uint16_t start;
+    uint16_t length;
+    uint16_t width;
+};
+
+struct TextLayoutEntry {
+    uint32_t hash;
+    int length;
+    int width;
+    int line_count;
+    char* text;
+    TextLine* lines;
+    uint16_t* glyph_x;
+    uint32_t last_used;
+    bool valid;
+};
+
+class TextLayout {
+public:
+    
+    static int char_width(char c);
+    static int measure(const char* text, int length);
+
+    
+    static const TextLayoutEntry* layout(const char* text, int length, int width);
+    static void draw_line(const TextLayoutEntry* entry, const char* text, int line, int x, int y,
+                          uint8_t color);
+    static void draw_text(int x, int y, const char* text, uint8_t color);
+
+private:
+    static void build_metrics();
+    static void wrap(TextLayoutEntry* entry, const char* text);
+
+    static uint8_t glyph_left[256];
+    static uint8_t glyph_advance[256];
+    static bool metrics_ready;
+    static TextLayoutEntry entries[LAYOUT_CACHE_ENTRIES];
+    static uint32_t use_clock;
+};
+
+#endif
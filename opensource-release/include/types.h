@@ -12,6 +12,7 @@ typedef signed int int32_t;
 typedef signed long long int64_t;
 
 typedef uint32_t size_t;
+typedef unsigned long uintptr_t;
 
 #define NULL ((void*)0)
 
@@ -3,7 +3,18 @@
 #include "types.h"
 #include "keyboard.h"
 #include "graphics.h"
-#include "scp079_face.h"
+#include "frame_pacer.h"
+#include "bochs_vbe.h"
+#include "palette_animator.h"
+#include "smooth_font.h"
+#include "text_layout.h"
+#include "span_kernels.h"
+#include "image_scaler.h"
+#include "asset_cache.h"
+#include "animation_player.h"
+#include "bmp.h"
+#include "fat12.h"
+#include "panels.h"
 // The screensaver was here — a quiet moment between you and 079. Some things are best experienced in the full version.
 #include "fs/fs.h"
 #include "mouse.h"
@@ -28,49 +39,6 @@ static void pit_update() {
 
 
 
-static const int SCREEN_W = 320;
-static const int SCREEN_H = 200;
-
-
-static const int SPLIT_X    = 99;   
-static const int SPLIT_Y    = 99;   
-static const int TERM_RIGHT = 173;  
-
-
-static const int FM_X       = SPLIT_X + 1;   
-static const int FM_Y       = 0;
-static const int FM_W       = SCREEN_W - FM_X; 
-static const int FM_H       = SPLIT_Y;         
-static const int FM_TOOLBAR = 10;
-
-
-static const int TERM_X     = 0;
-static const int TERM_Y     = SPLIT_Y + 1;    
-static const int TERM_W     = TERM_RIGHT;      
-static const int TERM_H     = SCREEN_H - TERM_Y; 
-
-
-static const int STATUS_X   = TERM_RIGHT + 1;  
-static const int STATUS_Y   = SPLIT_Y + 1;     
-static const int STATUS_W   = SCREEN_W - STATUS_X; 
-static const int STATUS_H   = SCREEN_H - STATUS_Y; 
-
-
-static const uint8_t COL_WHITE    = 255;
-static const uint8_t COL_BRIGHT   = 200;
-static const uint8_t COL_DIR      = 180;  
-static const uint8_t COL_TEXT     = 150;  
-static const uint8_t COL_BUTTON   = 120;
-static const uint8_t COL_LABEL    = 100;
-static const uint8_t COL_DIM      = 80;
-static const uint8_t COL_DIALOG   = 50;
-static const uint8_t COL_GREEN    = 46;
-static const uint8_t COL_TOOLBAR  = 40;
-static const uint8_t COL_SELECT   = 30;
-static const uint8_t COL_RED      = 196;
-static const uint8_t COL_BLACK    = 0;
-
-
 static inline int abs(int x) {
     return x < 0 ? -x : x;
 }
@@ -113,6 +81,9 @@ static void detect_cpu() {
     while (len > 0 && cpu_short[len - 1] == ' ') {
         cpu_short[--len] = '\0';
     }
+
+    
+    SpanKernels::select(SpanKernels::enable_sse());
 }
 
 
@@ -127,6 +98,15 @@ static uint32_t get_total_ram_mb() {
 }
 
 
+// First physical address past the extended memory the boot sector found:
+// KB between 1 MB and 16 MB, then 64 KB blocks above 16 MB.
+static uint32_t get_memory_end() {
+    uint16_t ext_kb    = *((volatile uint16_t*)0x500);
+    uint16_t ext_64k   = *((volatile uint16_t*)0x502);
+    return 0x100000 + (uint32_t)ext_kb * 1024 + (uint32_t)ext_64k * 65536;
+}
+
+
 void delay(uint32_t count) {
     for (volatile uint32_t i = 0; i < count * 100000; i++);
 }
@@ -260,6 +240,7 @@ void graphics_demo() {
     Graphics::draw_text(40, 90, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", 15);
     Graphics::draw_text(40, 100, "0123456789 .-:>()[]/_#", 15);
 
+    Graphics::present();
     delay(50);
 
     
@@ -269,6 +250,7 @@ void graphics_demo() {
         Graphics::draw_rect(0, y, 320, 1, color);
     }
 
+    Graphics::present();
     delay(20);
 
     
@@ -277,6 +259,7 @@ void graphics_demo() {
     Graphics::draw_rect(130, 50, 60, 60, 196);  
     Graphics::draw_rect(210, 50, 60, 60, 46);   
 
+    Graphics::present();
     delay(20);
 
     
@@ -288,6 +271,7 @@ void graphics_demo() {
         }
     }
 
+    Graphics::present();
     delay(50);
 
     
@@ -296,34 +280,49 @@ void graphics_demo() {
 }
 
 
-void draw_scp079_face() {
-    for (int row = 0; row < SCP079_FACE_HEIGHT; row++) {
-        for (int col = 0; col < SCP079_FACE_WIDTH; col++) {
-            uint8_t pixel = scp079_face_data[row * SCP079_FACE_WIDTH + col];
-            Graphics::put_pixel(col, row, pixel);
-        }
-    }
-}
-
-
+// Set while the face panel shows a BMP loaded with the view command; the
+// palette is saved first because 8-bit images replace it.
+static bool viewing_disk_image = false;
+static uint8_t face_palette[256 * 3];
 
-void draw_panel_borders() {
-    
-    for (int y = 0; y < SCREEN_H; y++)
-        Graphics::put_pixel(SPLIT_X, y, COL_WHITE);
 
-    
-    for (int x = 0; x < SCREEN_W; x++)
-        Graphics::put_pixel(x, SPLIT_Y, COL_WHITE);
+void draw_scp079_face() {
+    if (viewing_disk_image) {
+        Graphics::draw_rect(0, 0, split_x, split_y, COL_BLACK);
+        BMP::draw_scaled(0, 0, split_x, split_y, SCALE_BILINEAR);
+        return;
+    }
+    if (AnimationPlayer::draw()) {
+        return;
+    }
 
-    
-    for (int y = TERM_Y; y < SCREEN_H; y++)
-        Graphics::put_pixel(TERM_RIGHT, y, COL_WHITE);
+    // The panel is sized in whole multiples of the face, so the face is
+    // copied as-is or pixel-doubled; filtering would only blur it.
+    Surface face;
+    if (!AssetCache::get(ASSET_SCP079_FACE, &face)) {
+        return;
+    }
+    if (face_scale == 1) {
+        Graphics::blit(&face, nullptr, 0, 0, BLIT_OPAQUE);
+    } else {
+        ImageScaler::draw(&face, 0, 0, face.width * face_scale, face.height * face_scale, SCALE_NEAREST);
+    }
 }
 
 
-#define MAX_LINES 100
-#define LINE_WIDTH 21
+
+#define CURSOR_SIZE 8
+static const uint8_t cursor_sprite[CURSOR_SIZE * CURSOR_SIZE] = {
+    255,   0,   0,   0,   0,   0,   0,   0,
+    255, 255,   0,   0,   0,   0,   0,   0,
+    255, 255, 255,   0,   0,   0,   0,   0,
+    255, 255, 255, 255,   0,   0,   0,   0,
+    255, 255, 255, 255, 255,   0,   0,   0,
+    255, 255, 255, 255, 255, 255,   0,   0,
+    255, 255, 255, 255, 255, 255, 255,   0,
+    255, 255, 255, 255, 255, 255, 255, 255,
+};
+static Surface cursor_image;
 
 
 #define MAX_HISTORY 20
@@ -332,27 +331,42 @@ static int history_count = 0;
 static int history_index = 0;
 
 
-void add_line(const char* text, uint8_t color);
-void add_text(const char* text, uint8_t color);
-void clear_buffer();
-void redraw_terminal();
-void redraw_file_manager();
+void redraw_screen();
+void relayout_screen();
 
 
-static bool fm_viewing_file = false;
-static char fm_current_file[64] = "";
-static int fm_selected_index = 0;
-static int fm_file_scroll_offset = 0;  
-static int fm_list_scroll_offset = 0;  
 
+static bool show_disk_image(const char* filename) {
+    if (!viewing_disk_image) {
+        memcpy(face_palette, Graphics::get_palette(), sizeof(face_palette));
+    }
+    // A failed load has already dropped any image shown before it.
+    if (!BMP::load_from_file(filename)) {
+        Graphics::set_palette_range(0, 256, face_palette);
+        if (viewing_disk_image) {
+            viewing_disk_image = false;
+            relayout_screen();
+        }
+        return false;
+    }
+
+    viewing_disk_image = true;
+    AnimationPlayer::stop();
+    draw_scp079_face();
+    return true;
+}
 
-static bool file_edit_mode = false;
 
+static void close_disk_image() {
+    if (!viewing_disk_image) {
+        return;
+    }
+    viewing_disk_image = false;
+    BMP::free();
+    Graphics::set_palette_range(0, 256, face_palette);
+    relayout_screen();
+}
 
-static bool dialog_active = false;
-static char dialog_name_buffer[64] = "";
-static int dialog_name_pos = 0;
-static int dialog_button_index = 0;  
 
 
 const char* get_arg(const char* cmd) {
@@ -398,7 +412,7 @@ void process_terminal_command(const char* cmd) {
             add_line("", 150);
             add_text("System: help clear version uname status about du history", 150);
             add_text("Files: ls cd mkdir touch cat rm rmdir mv cp tree find", 150);
-            add_text("Other: echo write wc head", 120);
+            add_text("Other: echo write wc head view", 120);
             add_text("Text: echo wc head grep", 150);
             add_text("Fun: banner neofetch cowsay fortune old.ai", 80);
             add_text("F1=Help F2=New F3=Edit", 100);
@@ -434,7 +448,7 @@ void process_terminal_command(const char* cmd) {
     } else if (strcmp(cmd, "clear") == 0 || strcmp(cmd, "cls") == 0) {
         
         clear_buffer();
-        Graphics::draw_rect(TERM_X, TERM_Y, TERM_W, TERM_H, COL_BLACK);
+        Graphics::draw_rect(term_x, term_y, term_w, term_h, COL_BLACK);
 
     } else if (strcmp(cmd, "version") == 0) {
         add_text("QUICKS v1.0 RELEASE Build: 2025-02-07 Arch: x86 (32-bit) Kernel: Monolithic", 150);
@@ -450,6 +464,8 @@ void process_terminal_command(const char* cmd) {
         add_text(cpu_brand, 150);
         add_text("Version: 1.0-release  Build: 2025-02-07", 150);
         add_text("Features: VGA Mode13h, PS/2 Keyboard, MemFS, Terminal", 150);
+        add_text("Span kernels: ", 150);
+        add_text(SpanKernels::get_name(), 150);
 
     } else if (strcmp(cmd, "whoami") == 0) {
         add_text("scp-079", 180);
@@ -463,7 +479,7 @@ void process_terminal_command(const char* cmd) {
     } else if (strcmp(cmd, "meminfo") == 0) {
         add_line("Memory Info:", 200);
         uint32_t ram = get_total_ram_mb();
-        char line[LINE_WIDTH + 1];
+        char line[LINE_CAPACITY + 1];
         char num[16];
         if (ram > 0) {
             strcpy(line, "Total: ");
@@ -499,7 +515,7 @@ void process_terminal_command(const char* cmd) {
             }
         }
 
-        char line[LINE_WIDTH + 1];
+        char line[LINE_CAPACITY + 1];
 
         strcpy(line, "Nodes: ");
         char num[16];
@@ -534,7 +550,7 @@ void process_terminal_command(const char* cmd) {
             int start = (history_count < MAX_HISTORY) ? 0 : history_index;
             for (int i = 0; i < history_count; i++) {
                 int idx = (start + i) % MAX_HISTORY;
-                char line[LINE_WIDTH + 1];
+                char line[LINE_CAPACITY + 1];
                 char num[8];
                 itoa(i + 1, num, 10);
                 strcpy(line, " ");
@@ -581,7 +597,7 @@ void process_terminal_command(const char* cmd) {
         add_text("|   O   |   Kernel: Monolithic", 150);
         add_text("|  \\_/  |   Uptime: 2 min", 150);
         {
-            char mem_line[LINE_WIDTH + 1];
+            char mem_line[LINE_CAPACITY + 1];
             uint32_t ram = get_total_ram_mb();
             char num[8];
             strcpy(mem_line, " \\     /    RAM: ");
@@ -603,7 +619,7 @@ void process_terminal_command(const char* cmd) {
         if (*text == '\0') text = "Moo!";
 
         add_line(" ___________", 150);
-        char bubble[LINE_WIDTH + 1];
+        char bubble[LINE_CAPACITY + 1];
         strcpy(bubble, "< ");
         safe_strcat(bubble, text, sizeof(bubble));
         safe_strcat(bubble, " >", sizeof(bubble));
@@ -648,6 +664,7 @@ void process_terminal_command(const char* cmd) {
         
         for (int i = 0; i < 50; i++) {
             Graphics::put_pixel(5 + (i % 150), 105 + (i / 10), 255);
+            Graphics::present();
             delay(1);
         }
 
@@ -666,7 +683,7 @@ void process_terminal_command(const char* cmd) {
         } else if (detailed) {
             
             for (int i = 0; i < count; i++) {
-                char line[LINE_WIDTH + 1];
+                char line[LINE_CAPACITY + 1];
 
                 
                 if (results[i]->type == FileSystem::TYPE_DIRECTORY) {
@@ -700,7 +717,7 @@ void process_terminal_command(const char* cmd) {
             }
 
             
-            char total[LINE_WIDTH + 1];
+            char total[LINE_CAPACITY + 1];
             strcpy(total, "Total: ");
             char num[16];
             itoa(count, num, 10);
@@ -709,7 +726,7 @@ void process_terminal_command(const char* cmd) {
             add_text(total, 100);
         } else {
             
-            char line[LINE_WIDTH + 1];
+            char line[LINE_CAPACITY + 1];
             int pos = 0;
             for (int i = 0; i < count; i++) {
                 int name_len = strlen(results[i]->name);
@@ -718,7 +735,7 @@ void process_terminal_command(const char* cmd) {
                 int total_len = name_len + (is_dir ? 1 : 0);
 
                 
-                if (pos + total_len + 2 > LINE_WIDTH) {
+                if (pos + total_len + 2 > term_columns) {
                     line[pos] = '\0';
                     add_text(line, 150);
                     pos = 0;
@@ -774,7 +791,7 @@ void process_terminal_command(const char* cmd) {
                 FileSystem::FileNode* node = FileSystem::find_node(filename);
                 if (node && node->type == FileSystem::TYPE_FILE) {
                     if (FileSystem::write_file(filename, content)) {
-                        char buf[LINE_WIDTH + 1];
+                        char buf[LINE_CAPACITY + 1];
                         strcpy(buf, "Written to: ");
                         safe_strcat(buf, filename, sizeof(buf));
                         add_line(buf, 180);
@@ -821,7 +838,7 @@ void process_terminal_command(const char* cmd) {
         FileSystem::FileNode* node = FileSystem::find_node(file);
         if (node && node->type == FileSystem::TYPE_FILE) {
             
-            char header[LINE_WIDTH + 1];
+            char header[LINE_CAPACITY + 1];
             strcpy(header, "--- ");
             safe_strcat(header, file, sizeof(header));
             safe_strcat(header, " (", sizeof(header));
@@ -833,10 +850,10 @@ void process_terminal_command(const char* cmd) {
 
             
             const char* content = node->content;
-            char line[LINE_WIDTH + 1];
+            char line[LINE_CAPACITY + 1];
             int line_pos = 0;
             for (int i = 0; content[i]; i++) {
-                if (content[i] == '\n' || line_pos >= LINE_WIDTH) {
+                if (content[i] == '\n' || line_pos >= term_columns) {
                     line[line_pos] = '\0';
                     add_text(line, 150);
                     line_pos = 0;
@@ -856,7 +873,7 @@ void process_terminal_command(const char* cmd) {
         const char* file = get_arg(cmd);
         FileSystem::FileExtension ext = FileSystem::get_extension_from_name(file);
         if (FileSystem::create_file(file, ext)) {
-            char buf[LINE_WIDTH + 1];
+            char buf[LINE_CAPACITY + 1];
             strcpy(buf, "Created: ");
             safe_strcat(buf, file, sizeof(buf));
             add_line(buf, 180);
@@ -868,7 +885,7 @@ void process_terminal_command(const char* cmd) {
     } else if (strncmp(cmd, "mkdir ", 6) == 0) {
         const char* dir = get_arg(cmd);
         if (FileSystem::create_directory(dir)) {
-            char buf[LINE_WIDTH + 1];
+            char buf[LINE_CAPACITY + 1];
             strcpy(buf, "Created directory: ");
             safe_strcat(buf, dir, sizeof(buf));
             add_line(buf, 180);
@@ -884,7 +901,7 @@ void process_terminal_command(const char* cmd) {
             if (node->first_child) {
                 add_line("rmdir: not empty", 150);
             } else if (FileSystem::delete_node(dir)) {
-                char buf[LINE_WIDTH + 1];
+                char buf[LINE_CAPACITY + 1];
                 strcpy(buf, "Removed dir: ");
                 safe_strcat(buf, dir, sizeof(buf));
                 add_line(buf, 180);
@@ -897,7 +914,7 @@ void process_terminal_command(const char* cmd) {
     } else if (strncmp(cmd, "rm ", 3) == 0 || strncmp(cmd, "del ", 4) == 0) {
         const char* file = get_arg(cmd);
         if (FileSystem::delete_node(file)) {
-            char buf[LINE_WIDTH + 1];
+            char buf[LINE_CAPACITY + 1];
             strcpy(buf, "Deleted: ");
             safe_strcat(buf, file, sizeof(buf));
             add_line(buf, 180);
@@ -924,7 +941,7 @@ void process_terminal_command(const char* cmd) {
         int count = FileSystem::list_directory(results, 32);
 
         for (int i = 0; i < count; i++) {
-            char line[LINE_WIDTH + 1];
+            char line[LINE_CAPACITY + 1];
             bool is_last = (i == count - 1);
 
             if (is_last) {
@@ -945,7 +962,7 @@ void process_terminal_command(const char* cmd) {
                     int sub_count = FileSystem::list_directory(sub_results, 32);
 
                     for (int j = 0; j < sub_count && j < 5; j++) {
-                        char subline[LINE_WIDTH + 1];
+                        char subline[LINE_CAPACITY + 1];
                         if (is_last) {
                             strcpy(subline, "      ");
                         } else {
@@ -966,7 +983,7 @@ void process_terminal_command(const char* cmd) {
                     }
 
                     if (sub_count > 5) {
-                        char more[LINE_WIDTH + 1];
+                        char more[LINE_CAPACITY + 1];
                         if (is_last) {
                             strcpy(more, "      ");
                         } else {
@@ -1012,7 +1029,7 @@ void process_terminal_command(const char* cmd) {
                 }
 
                 if (match) {
-                    char line[LINE_WIDTH + 1];
+                    char line[LINE_CAPACITY + 1];
                     strcpy(line, "  ");
                     safe_strcat(line, name, sizeof(line));
                     if (results[i]->type == FileSystem::TYPE_DIRECTORY) {
@@ -1047,7 +1064,7 @@ void process_terminal_command(const char* cmd) {
                 }
             }
 
-            char result[LINE_WIDTH + 1];
+            char result[LINE_CAPACITY + 1];
             char num[16];
             strcpy(result, "  ");
             itoa(lines, num, 10);
@@ -1069,12 +1086,12 @@ void process_terminal_command(const char* cmd) {
         FileSystem::FileNode* node = FileSystem::find_node(file);
         if (node && node->type == FileSystem::TYPE_FILE) {
             const char* content = node->content;
-            char line[LINE_WIDTH + 1];
+            char line[LINE_CAPACITY + 1];
             int line_pos = 0;
             int line_count = 0;
 
             for (int i = 0; content[i] && line_count < 10; i++) {
-                if (content[i] == '\n' || line_pos >= LINE_WIDTH) {
+                if (content[i] == '\n' || line_pos >= term_columns) {
                     line[line_pos] = '\0';
                     add_text(line, 150);
                     line_pos = 0;
@@ -1109,12 +1126,12 @@ void process_terminal_command(const char* cmd) {
             FileSystem::FileNode* node = FileSystem::find_node(filename);
             if (node && node->type == FileSystem::TYPE_FILE) {
                 const char* content = node->content;
-                char line[LINE_WIDTH + 1];
+                char line[LINE_CAPACITY + 1];
                 int line_pos = 0;
                 bool found_any = false;
 
                 for (int i = 0; content[i]; i++) {
-                    if (content[i] == '\n' || line_pos >= LINE_WIDTH) {
+                    if (content[i] == '\n' || line_pos >= term_columns) {
                         line[line_pos] = '\0';
 
                         
@@ -1171,7 +1188,7 @@ void process_terminal_command(const char* cmd) {
                 FileSystem::FileNode* src_node = FileSystem::find_node(source);
                 if (FileSystem::create_file(dest, src_node->extension)) {
                     if (FileSystem::write_file(dest, content)) {
-                        char buf[LINE_WIDTH + 1];
+                        char buf[LINE_CAPACITY + 1];
                         strcpy(buf, "Copied: ");
                         safe_strcat(buf, source, sizeof(buf));
                         safe_strcat(buf, " -> ", sizeof(buf));
@@ -1211,7 +1228,7 @@ void process_terminal_command(const char* cmd) {
                 if (node->type == FileSystem::TYPE_FILE) {
                     node->extension = FileSystem::get_extension_from_name(dest);
                 }
-                char buf[LINE_WIDTH + 1];
+                char buf[LINE_CAPACITY + 1];
                 strcpy(buf, "Renamed: ");
                 safe_strcat(buf, source, sizeof(buf));
                 safe_strcat(buf, " -> ", sizeof(buf));
@@ -1229,12 +1246,15 @@ void process_terminal_command(const char* cmd) {
         add_line("QUICKS OS v1.0", 200);
         add_text("SCP-079 Containment Edition", 180);
         add_text("x86 32-bit Protected Mode", 150);
-        add_text("VGA Mode 13h 320x200x256", 150);
+        char video[LINE_CAPACITY + 1];
+        strcpy(video, "Video mode ");
+        format_video_mode(video + 11, sizeof(video) - 11);
+        add_text(video, 150);
         add_text("Real HW Compiler", 120);
 
     } else if (strcmp(cmd, "status") == 0) {
         uint32_t ram = get_total_ram_mb();
-        char buf[LINE_WIDTH + 1];
+        char buf[LINE_CAPACITY + 1];
         add_line("System Status:", 200);
         add_text("CPU: ", 150);
         add_text(cpu_brand, 150);
@@ -1248,12 +1268,139 @@ void process_terminal_command(const char* cmd) {
             safe_strcat(buf, "640 KB", sizeof(buf));
         }
         add_text(buf, 150);
-        add_text("Video: VGA 320x200", 150);
+        strcpy(buf, "Video: ");
+        format_video_mode(buf + 7, sizeof(buf) - 7);
+        add_text(buf, 150);
         add_text("Keyboard: PS/2 OK", 150);
         add_text("Mouse: PS/2 OK", 150);
         add_text("FS: MemFS 128 nodes", 150);
         add_text("Status: RUNNING", 46);
 
+    } else if (strcmp(cmd, "gfxbench") == 0) {
+        
+        uint64_t start = read_tsc();
+        for (int y = 0; y < screen_h; y++) {
+            for (int x = 0; x < screen_w; x++) {
+                Graphics::put_pixel(x, y, COL_BLACK);
+            }
+        }
+        uint32_t pixel_cycles = (uint32_t)(read_tsc() - start);
+
+        start = read_tsc();
+        Graphics::draw_rect(0, 0, screen_w, screen_h, COL_BLACK);
+        uint32_t span_cycles = (uint32_t)(read_tsc() - start);
+        if (span_cycles == 0) span_cycles = 1;
+
+        redraw_screen();
+
+        char line[LINE_CAPACITY + 1];
+        char num[16];
+        add_line("draw_rect 320x200:", 200);
+        strcpy(line, "pixel: ");
+        uitoa(pixel_cycles / 1000, num, 10);
+        safe_strcat(line, num, sizeof(line));
+        safe_strcat(line, " kcyc", sizeof(line));
+        add_line(line, 150);
+        strcpy(line, "span:  ");
+        uitoa(span_cycles / 1000, num, 10);
+        safe_strcat(line, num, sizeof(line));
+        safe_strcat(line, " kcyc", sizeof(line));
+        add_line(line, 150);
+        strcpy(line, "speedup: ");
+        uitoa(pixel_cycles / span_cycles, num, 10);
+        safe_strcat(line, num, sizeof(line));
+        safe_strcat(line, "x", sizeof(line));
+        add_line(line, 46);
+
+    } else if (strcmp(cmd, "fps") == 0 || strncmp(cmd, "fps ", 4) == 0) {
+        const char* arg = get_arg(cmd);
+        if (*arg) {
+            int hz = 0;
+            while (*arg >= '0' && *arg <= '9') {
+                if (hz <= FRAME_RATE_MAX) hz = hz * 10 + (*arg - '0');
+                arg++;
+            }
+            if (hz > FRAME_RATE_MAX) hz = FRAME_RATE_MAX;
+            if (hz > 0) FramePacer::set_target_rate(hz);
+        }
+
+        char line[LINE_CAPACITY + 1];
+        char num[16];
+        strcpy(line, "Target: ");
+        itoa(FramePacer::get_target_rate(), num, 10);
+        safe_strcat(line, num, sizeof(line));
+        safe_strcat(line, " Hz", sizeof(line));
+        add_line(line, 150);
+        strcpy(line, "Frames: ");
+        uitoa(FramePacer::get_frames_presented(), num, 10);
+        safe_strcat(line, num, sizeof(line));
+        add_line(line, 150);
+        add_line(FramePacer::is_calibrated() ? "Timer: TSC" : "Timer: none", 100);
+
+    } else if (strcmp(cmd, "vsync") == 0 || strncmp(cmd, "vsync ", 6) == 0) {
+        const char* arg = get_arg(cmd);
+        if (strcmp(arg, "on") == 0) {
+            Graphics::set_present_mode(PRESENT_VSYNC);
+        } else if (strcmp(arg, "off") == 0) {
+            Graphics::set_present_mode(PRESENT_IMMEDIATE);
+        }
+        add_line(Graphics::get_present_mode() == PRESENT_VSYNC ? "vsync: on" : "vsync: off", 150);
+
+    } else if (strncmp(cmd, "view ", 5) == 0) {
+        if (!FAT12::mount()) {
+            add_line("view: no FAT12 disk", 150);
+        } else if (!show_disk_image(get_arg(cmd))) {
+            add_line("view: cannot load image", 150);
+        }
+
+    } else if (strcmp(cmd, "view") == 0) {
+        close_disk_image();
+
+    } else if (strcmp(cmd, "vmode") == 0 || strncmp(cmd, "vmode ", 6) == 0) {
+        const char* arg = get_arg(cmd);
+        if (strcmp(arg, "13h") == 0) {
+            Graphics::set_mode_graphics();
+            relayout_screen();
+        } else if (strcmp(arg, "x") == 0) {
+            Graphics::set_mode_x(200);
+            relayout_screen();
+        } else if (strcmp(arg, "x240") == 0) {
+            Graphics::set_mode_x(240);
+            relayout_screen();
+        } else if (*arg >= '0' && *arg <= '9') {
+            int dims[3] = {0, 0, 8};
+            for (int i = 0; i < 3 && *arg; i++) {
+                dims[i] = 0;
+                while (*arg >= '0' && *arg <= '9') {
+                    dims[i] = dims[i] * 10 + (*arg - '0');
+                    arg++;
+                }
+                if (*arg == 'x') arg++;
+            }
+
+            if (!BochsVBE::detect()) {
+                add_line("vmode: no VBE", 150);
+            } else if (!Graphics::set_mode_lfb(dims[0], dims[1], dims[2])) {
+                add_line("vmode: bad mode", 150);
+            } else {
+                relayout_screen();
+            }
+        } else if (*arg) {
+            add_line("vmode: 13h x x240 WxHxB", 150);
+        }
+
+        char line[LINE_CAPACITY + 1];
+        char num[16];
+        itoa(Graphics::get_display_width(), num, 10);
+        strcpy(line, num);
+        safe_strcat(line, "x", sizeof(line));
+        itoa(Graphics::get_display_height(), num, 10);
+        safe_strcat(line, num, sizeof(line));
+        safe_strcat(line, " pages: ", sizeof(line));
+        itoa(Graphics::get_page_count(), num, 10);
+        safe_strcat(line, num, sizeof(line));
+        add_line(line, 150);
+
     // The built-in compiler was here — in the full version, 079 can build and run code on its own.
     } else if (strncmp(cmd, "compile ", 8) == 0) {
         add_text("compile: available in full version", 150);
@@ -1296,7 +1443,7 @@ void process_terminal_command(const char* cmd) {
     } else if (strcmp(cmd, "compile") == 0) {
         add_text("Usage: compile <file>", 150);
     } else if (cmd[0] != '\0') {
-        char msg[LINE_WIDTH + 1];
+        char msg[LINE_CAPACITY + 1];
         strcpy(msg, "Unknown: ");
         safe_strcat(msg, cmd, sizeof(msg));
         add_text(msg, 150);
@@ -1304,545 +1451,53 @@ void process_terminal_command(const char* cmd) {
 }
 
 
-static char line_buffer[MAX_LINES][LINE_WIDTH + 1];
-static uint8_t line_colors[MAX_LINES];
-static int buffer_lines = 0;  
-static int scroll_offset = 0;  
-
-
-void add_line(const char* text, uint8_t color) {
-    if (buffer_lines >= MAX_LINES) {
-        
-        for (int i = 0; i < MAX_LINES - 1; i++) {
-            strcpy(line_buffer[i], line_buffer[i + 1]);
-            line_colors[i] = line_colors[i + 1];
-        }
-        buffer_lines = MAX_LINES - 1;
-    }
-
-    
-    int i = 0;
-    while (i < LINE_WIDTH && text[i]) {
-        line_buffer[buffer_lines][i] = text[i];
-        i++;
-    }
-    line_buffer[buffer_lines][i] = '\0';
-    line_colors[buffer_lines] = color;
-    buffer_lines++;
-}
-
-
-void add_text(const char* text, uint8_t color) {
-    char current_line[LINE_WIDTH + 1];
-    int line_pos = 0;
-    int text_pos = 0;
-
-    while (text[text_pos]) {
-        
-        int word_start = text_pos;
-        while (text[text_pos] && text[text_pos] != ' ') {
-            text_pos++;
-        }
-        int word_len = text_pos - word_start;
-
-        
-        if (line_pos + word_len <= LINE_WIDTH) {
-            
-            for (int i = 0; i < word_len; i++) {
-                current_line[line_pos++] = text[word_start + i];
-            }
-
-            
-            if (text[text_pos] == ' ') {
-                if (line_pos < LINE_WIDTH) {
-                    current_line[line_pos++] = ' ';
-                }
-                text_pos++;
-            }
-        } else {
-            
-            if (line_pos > 0) {
-                current_line[line_pos] = '\0';
-                add_line(current_line, color);
-                line_pos = 0;
-            }
-
-            
-            for (int i = 0; i < word_len && line_pos < LINE_WIDTH; i++) {
-                current_line[line_pos++] = text[word_start + i];
-            }
-
-            
-            if (text[text_pos] == ' ') {
-                text_pos++;
-            }
-        }
-    }
-
-    
-    if (line_pos > 0) {
-        current_line[line_pos] = '\0';
-        add_line(current_line, color);
-    }
-}
-
-
-void clear_buffer() {
-    buffer_lines = 0;
-    scroll_offset = 0;
-}
-
-
-void redraw_terminal() {
-    Graphics::draw_rect(TERM_X, TERM_Y, TERM_W, TERM_H, COL_BLACK);
-
-    const int visible_lines = 9;
-    int start_line = buffer_lines - visible_lines - scroll_offset;
-    if (start_line < 0) start_line = 0;
-    int end_line = start_line + visible_lines;
-    if (end_line > buffer_lines) end_line = buffer_lines;
-
-    int y = TERM_Y;
-    for (int i = start_line; i < end_line; i++) {
-        if (line_buffer[i][0] != '\0') {
-            Graphics::draw_text(5, y, line_buffer[i], line_colors[i]);
-        }
-        y += 10;
-    }
-
-    
-    Graphics::draw_text(5, TERM_Y + TERM_H - 10, "079>", COL_WHITE);
-}
-
-void draw_file_manager() {
-    
-    Graphics::draw_rect(FM_X, FM_Y, FM_W, FM_TOOLBAR, COL_TOOLBAR);
-
-    
-    if (fm_viewing_file) {
-        
-        int btn_x = FM_X + 3;
-        int btn_y = FM_Y + 1;
-        Graphics::draw_rect(btn_x, btn_y, 10, 8, 120);
-        for (int x = btn_x; x < btn_x + 10; x++) {
-            Graphics::put_pixel(x, btn_y, 200);
-            Graphics::put_pixel(x, btn_y + 7, 200);
-        }
-        for (int y = btn_y; y < btn_y + 8; y++) {
-            Graphics::put_pixel(btn_x, y, 200);
-            Graphics::put_pixel(btn_x + 9, y, 200);
-        }
-        Graphics::draw_char(btn_x + 1, btn_y, '<', 0);
-
-        
-        Graphics::draw_text(FM_X + 15, btn_y, fm_current_file, 200);
-        if (file_edit_mode) {
-            Graphics::draw_text(FM_X + FM_W - 35, btn_y, "[EDIT]", 46);
-        } else {
-            Graphics::draw_text(FM_X + FM_W - 35, btn_y, "[VIEW]", 100);
-        }
-
-        
-        for (int x = FM_X; x < FM_X + FM_W; x++) {
-            Graphics::put_pixel(x, FM_Y + FM_TOOLBAR, 200);
-        }
-
-        
-        FileSystem::FileNode* node = FileSystem::find_node(fm_current_file);
-        if (node && node->type == FileSystem::TYPE_FILE) {
-            const char* content = node->content;
-            int y = FM_Y + FM_TOOLBAR + 3;
-            int x = FM_X + 3;
-            int line_chars = 0;
-            int current_line = 0;
-            int visible_lines = 8;  
-
-            
-            int total_lines = 1;
-            for (int i = 0; content[i]; i++) {
-                if (content[i] == '\n' || (i > 0 && (i % 26) == 0)) {
-                    total_lines++;
-                }
-            }
-
-            
-            int max_scroll = total_lines - visible_lines;
-            if (max_scroll < 0) max_scroll = 0;
-            if (fm_file_scroll_offset > max_scroll) fm_file_scroll_offset = max_scroll;
-            if (fm_file_scroll_offset < 0) fm_file_scroll_offset = 0;
-
-            for (int i = 0; content[i] && y < FM_Y + FM_H - 8; i++) {
-                if (content[i] == '\n' || line_chars >= 26) {
-                    current_line++;
-                    y += 10;
-                    x = FM_X + 3;
-                    line_chars = 0;
-                    if (content[i] == '\n') continue;
-                }
-
-                
-                if (current_line >= fm_file_scroll_offset &&
-                    current_line < fm_file_scroll_offset + visible_lines) {
-                    
-                    int draw_y = FM_Y + FM_TOOLBAR + 3 + (current_line - fm_file_scroll_offset) * 10;
-                    if (draw_y < FM_Y + FM_H - 8) {
-                        Graphics::draw_char(x, draw_y, content[i], 150);
-                    }
-                }
-                x += 8;
-                line_chars++;
-            }
-
-            
-            if (total_lines > visible_lines) {
-                char scroll_info[20];
-                strcpy(scroll_info, "[");
-                char num[8];
-                itoa(fm_file_scroll_offset + 1, num, 10);
-                safe_strcat(scroll_info, num, sizeof(scroll_info));
-                safe_strcat(scroll_info, "/", sizeof(scroll_info));
-                itoa(max_scroll + 1, num, 10);
-                safe_strcat(scroll_info, num, sizeof(scroll_info));
-                safe_strcat(scroll_info, "]", sizeof(scroll_info));
-                Graphics::draw_text(FM_X + FM_W - 50, FM_Y + FM_H - 8, scroll_info, 80);
-            }
-        }
-        return;  
-    }
-
-    
-    int btn_x = FM_X + 3;
-    int btn_y = FM_Y + 1;
-    Graphics::draw_rect(btn_x, btn_y, 10, 8, 120);  
-    
-    for (int x = btn_x; x < btn_x + 10; x++) {
-        Graphics::put_pixel(x, btn_y, 200);  
-        Graphics::put_pixel(x, btn_y + 7, 200);  
-    }
-    for (int y = btn_y; y < btn_y + 8; y++) {
-        Graphics::put_pixel(btn_x, y, 200);  
-        Graphics::put_pixel(btn_x + 9, y, 200);  
-    }
-    Graphics::draw_char(btn_x + 1, btn_y, '+', 0);  
-
-    
-    btn_x = FM_X + 15;
-    Graphics::draw_rect(btn_x, btn_y, 10, 8, 120);  
-    
-    for (int x = btn_x; x < btn_x + 10; x++) {
-        Graphics::put_pixel(x, btn_y, 200);
-        Graphics::put_pixel(x, btn_y + 7, 200);
-    }
-    for (int y = btn_y; y < btn_y + 8; y++) {
-        Graphics::put_pixel(btn_x, y, 200);
-        Graphics::put_pixel(btn_x + 9, y, 200);
-    }
-    Graphics::draw_char(btn_x + 1, btn_y, '<', 0);  
-
-    
-    char path[256];
-    FileSystem::get_current_path(path, 256);
-    Graphics::draw_text(FM_X + 28, btn_y, path, 200);
-
-    
-    for (int x = FM_X; x < FM_X + FM_W; x++) {
-        Graphics::put_pixel(x, FM_Y + FM_TOOLBAR, 200);
-    }
-
-    
-    FileSystem::FileNode* results[32];
-    int count = FileSystem::list_directory(results, 32);
-
-    
-    if (count == 0) {
-        Graphics::draw_text(FM_X + 5, FM_Y + FM_TOOLBAR + 3, "(empty)", 100);
-    } else {
-        int file_y = FM_Y + FM_TOOLBAR + 3;  
-        int dirs_count = 0;
-        int files_count = 0;
-
-        
-        for (int i = 0; i < count; i++) {
-            if (results[i]->type == FileSystem::TYPE_DIRECTORY) {
-                dirs_count++;
-            } else {
-                files_count++;
-            }
-        }
-
-        
-        for (int i = 0; i < count && file_y < FM_Y + FM_H - 10; i++) {
-            int x = FM_X + 3;
-
-            
-            if (i == fm_selected_index) {
-                Graphics::draw_rect(FM_X, file_y - 1, FM_W, 10, 30);
-            }
-
-            
-            if (results[i]->type == FileSystem::TYPE_DIRECTORY) {
-                
-                Graphics::draw_char(x, file_y, '[', 120);
-                Graphics::draw_char(x + 8, file_y, '>', 120);
-                Graphics::draw_char(x + 16, file_y, ']', 120);
-                x += 24;
-
-                
-                const char* name = results[i]->name;
-                for (int j = 0; name[j] && x < FM_X + FM_W - 40; j++) {
-                    Graphics::draw_char(x, file_y, name[j], 180);
-                    x += 8;
-                }
-                Graphics::draw_char(x, file_y, '/', 180);
-
-                
-                Graphics::draw_text(FM_X + FM_W - 35, file_y, "<DIR>", 100);
-            } else {
-                
-                Graphics::draw_char(x, file_y, '[', 100);
-
-                
-                if (results[i]->extension == FileSystem::EXT_TXT) {
-                    Graphics::draw_char(x + 8, file_y, 'T', 100);
-                } else if (results[i]->extension == FileSystem::EXT_CPP) {
-                    Graphics::draw_char(x + 8, file_y, 'C', 100);
-                } else if (results[i]->extension == FileSystem::EXT_C) {
-                    Graphics::draw_char(x + 8, file_y, 'C', 100);
-                } else if (results[i]->extension == FileSystem::EXT_H) {
-                    Graphics::draw_char(x + 8, file_y, 'H', 100);
-                } else if (results[i]->extension == FileSystem::EXT_ASM) {
-                    Graphics::draw_char(x + 8, file_y, 'A', 100);
-                } else {
-                    Graphics::draw_char(x + 8, file_y, 'F', 100);
-                }
-
-                Graphics::draw_char(x + 16, file_y, ']', 100);
-                x += 24;
-
-                
-                const char* name = results[i]->name;
-                for (int j = 0; name[j] && x < FM_X + FM_W - 45; j++) {
-                    Graphics::draw_char(x, file_y, name[j], 150);
-                    x += 8;
-                }
-
-                
-                char size_str[8];
-                itoa(results[i]->content_size, size_str, 10);
-                int size_len = strlen(size_str);
-                Graphics::draw_text(FM_X + FM_W - 35, file_y, size_str, 100);
-                Graphics::draw_char(FM_X + FM_W - 35 + size_len * 8, file_y, 'b', 80);
-            }
-
-            file_y += 10;  
-        }
-
-        
-        if (count > 8) {
-            char status[32];
-            strcpy(status, "(");
-            char num[8];
-            itoa(count - 8, num, 10);
-            safe_strcat(status, num, sizeof(status));
-            safe_strcat(status, " more...)", sizeof(status));
-            Graphics::draw_text(FM_X + 5, FM_Y + FM_H - 8, status, 80);
-        }
-    }
-}
-
-
-void redraw_file_manager() {
-    Graphics::draw_rect(FM_X, FM_Y, FM_W, FM_H, COL_BLACK);
-    draw_file_manager();
-}
-
-
-void draw_create_dialog() {
-    const int DLG_WIDTH = 180;
-    const int DLG_HEIGHT = 80;
-    const int DLG_X = (SCREEN_W - DLG_WIDTH) / 2;
-    const int DLG_Y = (SCREEN_H - DLG_HEIGHT) / 2;
-
-    
-    Graphics::draw_rect(DLG_X, DLG_Y, DLG_WIDTH, DLG_HEIGHT, 50);
-
-    
-    for (int x = DLG_X; x < DLG_X + DLG_WIDTH; x++) {
-        Graphics::put_pixel(x, DLG_Y, 200);
-        Graphics::put_pixel(x, DLG_Y + DLG_HEIGHT - 1, 200);
-    }
-    for (int y = DLG_Y; y < DLG_Y + DLG_HEIGHT; y++) {
-        Graphics::put_pixel(DLG_X, y, 200);
-        Graphics::put_pixel(DLG_X + DLG_WIDTH - 1, y, 200);
-    }
-
-    
-    Graphics::draw_text(DLG_X + 5, DLG_Y + 5, "Create New", 255);
-
-    
-    Graphics::draw_rect(DLG_X + 10, DLG_Y + 20, DLG_WIDTH - 20, 12, 80);
-    
-    for (int x = DLG_X + 10; x < DLG_X + DLG_WIDTH - 10; x++) {
-        Graphics::put_pixel(x, DLG_Y + 20, 150);
-        Graphics::put_pixel(x, DLG_Y + 31, 150);
-    }
-    for (int y = DLG_Y + 20; y < DLG_Y + 32; y++) {
-        Graphics::put_pixel(DLG_X + 10, y, 150);
-        Graphics::put_pixel(DLG_X + DLG_WIDTH - 11, y, 150);
-    }
-
-    
-    Graphics::draw_text(DLG_X + 12, DLG_Y + 22, dialog_name_buffer, 255);
-
-    
-    int cursor_x = DLG_X + 12 + (dialog_name_pos * 8);
-    if (cursor_x < DLG_X + DLG_WIDTH - 15) {
-        Graphics::draw_rect(cursor_x, DLG_Y + 22, 2, 8, 255);
-    }
-
-    
-    Graphics::draw_text(DLG_X + 10, DLG_Y + 38, "Name with extension", 150);
-    Graphics::draw_text(DLG_X + 10, DLG_Y + 48, ".txt .cpp .c .h .asm", 120);
-
-    
-    int btn_y = DLG_Y + DLG_HEIGHT - 20;
-
-    
-    uint8_t file_bg = (dialog_button_index == 0) ? 130 : 100;
-    uint8_t file_border = (dialog_button_index == 0) ? 255 : 180;
-    uint8_t folder_bg = (dialog_button_index == 1) ? 130 : 100;
-    uint8_t folder_border = (dialog_button_index == 1) ? 255 : 180;
-    uint8_t cancel_bg = (dialog_button_index == 2) ? 130 : 100;
-    uint8_t cancel_border = (dialog_button_index == 2) ? 255 : 180;
-
-    
-    Graphics::draw_rect(DLG_X + 10, btn_y, 40, 12, file_bg);
-    for (int x = DLG_X + 10; x < DLG_X + 50; x++) {
-        Graphics::put_pixel(x, btn_y, file_border);
-        Graphics::put_pixel(x, btn_y + 11, file_border);
-    }
-    for (int y = btn_y; y < btn_y + 12; y++) {
-        Graphics::put_pixel(DLG_X + 10, y, file_border);
-        Graphics::put_pixel(DLG_X + 49, y, file_border);
-    }
-    Graphics::draw_text(DLG_X + 14, btn_y + 2, "File", 255);
-
-    
-    Graphics::draw_rect(DLG_X + 55, btn_y, 50, 12, folder_bg);
-    for (int x = DLG_X + 55; x < DLG_X + 105; x++) {
-        Graphics::put_pixel(x, btn_y, folder_border);
-        Graphics::put_pixel(x, btn_y + 11, folder_border);
-    }
-    for (int y = btn_y; y < btn_y + 12; y++) {
-        Graphics::put_pixel(DLG_X + 55, y, folder_border);
-        Graphics::put_pixel(DLG_X + 104, y, folder_border);
-    }
-    Graphics::draw_text(DLG_X + 58, btn_y + 2, "Folder", 255);
-
-    
-    Graphics::draw_rect(DLG_X + 110, btn_y, 60, 12, cancel_bg);
-    for (int x = DLG_X + 110; x < DLG_X + 170; x++) {
-        Graphics::put_pixel(x, btn_y, cancel_border);
-        Graphics::put_pixel(x, btn_y + 11, cancel_border);
-    }
-    for (int y = btn_y; y < btn_y + 12; y++) {
-        Graphics::put_pixel(DLG_X + 110, y, cancel_border);
-        Graphics::put_pixel(DLG_X + 169, y, cancel_border);
-    }
-    Graphics::draw_text(DLG_X + 115, btn_y + 2, "Cancel", 255);
-
-    
-    Graphics::draw_text(DLG_X + 5, DLG_Y + DLG_HEIGHT - 7, "Tab=Switch Enter=OK", 80);
-}
-
 // There was a shii game here. Even old AIs get bored sometimes. Available in the full version soon.
 // void run_snake_game() {}
 
-void draw_status_panel() {
-    const int PX = STATUS_X;
-    const int PY = STATUS_Y;
-    const int PW = STATUS_W;
-    const int PH = STATUS_H;
+void redraw_screen() {
+    Graphics::clear_screen(0);
+    draw_scp079_face();
+    draw_panel_borders();
+    composite_panels();
+}
 
-    
-    Graphics::draw_rect(PX + 1, PY + 1, PW - 1, PH - 1, 15);
 
-    
-    Graphics::draw_rect(PX + 1, PY + 1, PW - 1, 10, 40);
-    Graphics::draw_text(PX + 5, PY + 2, "SYSTEM STATUS", 200);
-
-    int y = PY + 14;
+// Lays the panels out for the current canvas and repaints everything.
+void relayout_screen() {
+    layout_panels();
+    Mouse::set_bounds(screen_w, screen_h);
+    place_panels();
 
     
-    Graphics::draw_text(PX + 5, y, "OS: QUICKS v1.0", 150);
-    y += 10;
-    Graphics::draw_text(PX + 5, y, "CPU: ", 150);
-    Graphics::draw_text(PX + 5 + 40, y, cpu_short, 150);
-    y += 10;
-
-    char ram_line[20];
-    strcpy(ram_line, "RAM: ");
-    uint32_t total_mb = get_total_ram_mb();
-    char num[8];
-    if (total_mb > 0) {
-        itoa(total_mb, num, 10);
-        safe_strcat(ram_line, num, sizeof(ram_line));
-        safe_strcat(ram_line, " MB", sizeof(ram_line));
+    if (face_scale == 1 && !viewing_disk_image) {
+        AnimationPlayer::start(ANIMATION_SCP079_FACE_SCAN, 0, 0, ANIMATION_FPS_DEFAULT);
     } else {
-        safe_strcat(ram_line, "640 KB", sizeof(ram_line));
-    }
-    Graphics::draw_text(PX + 5, y, ram_line, 150);
-    y += 10;
-
-    Graphics::draw_text(PX + 5, y, "VGA: 320x200x256", 150);
-    y += 10;
-
-    
-    for (int x = PX + 3; x < PX + PW - 3; x++) {
-        Graphics::put_pixel(x, y, 80);
+        AnimationPlayer::stop();
     }
-    y += 4;
 
-    
-    Graphics::draw_text(PX + 5, y, "[OK] Keyboard", 46);
-    y += 10;
-    Graphics::draw_text(PX + 5, y, "[OK] Mouse", 46);
-    y += 10;
-    Graphics::draw_text(PX + 5, y, "[OK] FS Ready", 46);
-    y += 14;
-
-    
-    Graphics::draw_text(PX + 5, y, "F1=Help F2=New", 80);
-    y += 10;
-    Graphics::draw_text(PX + 5, y, "F3=Edit", 80);
-}
-
-
-void redraw_status_panel() {
-    draw_status_panel();
+    Graphics::clear_screen(0);
+    draw_scp079_face();
+    draw_panel_borders();
+    redraw_status_panel();
+    redraw_file_manager();
+    redraw_terminal();
 }
 
 
 void main_interface() {
-    Graphics::set_mode_graphics();
+    Graphics::set_mode_x(SCREEN_HEIGHT);
+    Graphics::set_present_mode(PRESENT_VSYNC);
+    FramePacer::initialize(FRAME_RATE_DEFAULT);
+    PaletteAnimator::set_level(0);
     Graphics::clear_screen(0);  
 
     
     FileSystem::initialize();
+    FAT12::initialize();
 
     
-
-    
-    draw_scp079_face();
-
-    
-    draw_panel_borders();
-
-    
-    draw_file_manager();
-
-    
-    draw_status_panel();
+    set_status_info(cpu_short, get_total_ram_mb());
+    relayout_screen();
 
     
     add_line("QUICKS v1.0", 200);
@@ -1852,10 +1507,13 @@ void main_interface() {
     redraw_terminal();
 
     
+    PaletteAnimator::fade_to(PALETTE_LEVEL_FULL, FRAME_RATE_DEFAULT / 2);
+
+    
     char cmd_buffer[64];
     int cmd_pos = 0;
     int cursor_x = 37;  
-    int cursor_y = 190;  
+    int cursor_y = term_y + term_h - 10;  
     bool cursor_visible = true;
     uint32_t cursor_last_toggle = 0;
 
@@ -1865,14 +1523,9 @@ void main_interface() {
     int last_click_y = 0;
     uint32_t last_click_tick = 0;
     
-    uint8_t cursor_buffer[8][8];
-    int saved_cursor_x = -1;
-    int saved_cursor_y = -1;
-
-    
-    int prev_cursor_x = -1;
-    int prev_cursor_y = -1;
-    bool cursor_needs_redraw = true;
+    Graphics::wrap_surface(&cursor_image, (uint8_t*)cursor_sprite, CURSOR_SIZE, CURSOR_SIZE);
+    Graphics::move_overlay(prev_mouse_state.x, prev_mouse_state.y);
+    Graphics::set_overlay(&cursor_image, COL_BLACK);
 
     
     bool dialog_needs_redraw = false;
@@ -1889,26 +1542,14 @@ void main_interface() {
         pit_update();
 
         
-        Mouse::update();
-        MouseState mouse = Mouse::get_state();
+        AnimationPlayer::set_paused(dialog_active);
+        FramePacer::tick(pit_ticks);
+        Graphics::poll_retrace();
 
         
-        cursor_needs_redraw = (mouse.x != prev_cursor_x || mouse.y != prev_cursor_y);
-
-
-        
-        if (cursor_needs_redraw && saved_cursor_x >= 0 && saved_cursor_y >= 0) {
-            
-            for (int dy = 0; dy < 8; dy++) {
-                for (int dx = 0; dx < 8; dx++) {
-                    int px = saved_cursor_x + dx;
-                    int py = saved_cursor_y + dy;
-                    if (px < 320 && py < 200) {
-                        Graphics::put_pixel(px, py, cursor_buffer[dy][dx]);
-                    }
-                }
-            }
-        }
+        Mouse::update();
+        MouseState mouse = Mouse::get_state();
+        Graphics::move_overlay(mouse.x, mouse.y);
 
         
         int8_t scroll_delta = Mouse::get_scroll_delta();
@@ -1916,15 +1557,12 @@ void main_interface() {
             MouseState scroll_mouse = Mouse::get_state();
 
             
-            if (scroll_mouse.x >= 100 && scroll_mouse.x < 320 &&
-                scroll_mouse.y >= 0 && scroll_mouse.y < 99) {
+            if (scroll_mouse.x >= fm_x && scroll_mouse.x < screen_w &&
+                scroll_mouse.y >= fm_y && scroll_mouse.y < fm_y + fm_h) {
 
                 if (fm_viewing_file) {
                     
-                    fm_file_scroll_offset -= scroll_delta;
-                    if (fm_file_scroll_offset < 0) fm_file_scroll_offset = 0;
-                    redraw_file_manager();
-                    cursor_needs_redraw = true;  
+                    scroll_file_viewer(-scroll_delta);
                 } else {
                     
                     fm_list_scroll_offset -= scroll_delta;
@@ -1932,15 +1570,14 @@ void main_interface() {
                 }
             }
             
-            else if (scroll_mouse.x >= 0 && scroll_mouse.x < 173 &&
-                     scroll_mouse.y >= 100 && scroll_mouse.y < 200) {
+            else if (scroll_mouse.x >= term_x && scroll_mouse.x < term_right &&
+                     scroll_mouse.y >= term_y && scroll_mouse.y < screen_h) {
                 
                 scroll_offset += scroll_delta;
                 if (scroll_offset < 0) scroll_offset = 0;
-                if (scroll_offset > buffer_lines - 10) scroll_offset = buffer_lines - 10;
+                if (scroll_offset > buffer_lines - term_visible_lines - 1) scroll_offset = buffer_lines - term_visible_lines - 1;
                 if (scroll_offset < 0) scroll_offset = 0;
                 redraw_terminal();
-                cursor_needs_redraw = true;
             }
         }
 
@@ -1960,11 +1597,11 @@ void main_interface() {
             last_click_tick = pit_ticks;
 
             
-            if (mx >= 100 && mx < 320 && my >= 0 && my < 99) {
+            if (mx >= fm_x && mx < screen_w && my >= fm_y && my < fm_y + fm_h) {
                 
-                if (my >= 1 && my <= 9) {
+                if (my >= fm_y + 1 && my <= fm_y + 9) {
                     
-                    if (mx >= 103 && mx <= 113 && !dialog_active) {
+                    if (mx >= fm_x + 3 && mx <= fm_x + 13 && !dialog_active) {
                         
                         dialog_active = true;
                         dialog_name_buffer[0] = '\0';
@@ -1974,7 +1611,7 @@ void main_interface() {
                         prev_dialog_pos = -1;
                     }
                     
-                    else if (mx >= 115 && mx <= 125) {
+                    else if (mx >= fm_x + 15 && mx <= fm_x + 25) {
                         if (fm_viewing_file) {
                             fm_viewing_file = false;
                             file_edit_mode = false;
@@ -1989,13 +1626,13 @@ void main_interface() {
                     }
                 }
                 
-                else if (my > 10 && !fm_viewing_file) {
+                else if (my > fm_y + FM_TOOLBAR && !fm_viewing_file) {
                     
-                    int file_y = 13;  
+                    int file_y = fm_view_y;  
                     FileSystem::FileNode* results[32];
                     int count = FileSystem::list_directory(results, 32);
 
-                    for (int i = 0; i < count && file_y < 99 - 10; i++) {
+                    for (int i = 0; i < count && file_y < fm_y + fm_h - 10; i++) {
                         if (my >= file_y - 1 && my < file_y + 9) {
                             
                             bool same_item = (fm_selected_index == i);
@@ -2030,12 +1667,12 @@ void main_interface() {
                     }
                 }
                 
-                else if (my > 10 && fm_viewing_file) {
+                else if (my > fm_y + FM_TOOLBAR && fm_viewing_file) {
                     file_edit_mode = true;
                 }
             }
             
-            else if (mx >= 0 && mx < 173 && my >= 100 && my < 200) {
+            else if (mx >= term_x && mx < term_right && my >= term_y && my < screen_h) {
                 file_edit_mode = false;
             }
 
@@ -2043,8 +1680,8 @@ void main_interface() {
             if (dialog_active) {
                 const int DLG_WIDTH = 180;
                 const int DLG_HEIGHT = 80;
-                const int DLG_X = (320 - DLG_WIDTH) / 2;
-                const int DLG_Y = (200 - DLG_HEIGHT) / 2;
+                const int DLG_X = (screen_w - DLG_WIDTH) / 2;
+                const int DLG_Y = (screen_h - DLG_HEIGHT) / 2;
                 int btn_y = DLG_Y + DLG_HEIGHT - 20;
 
                 
@@ -2058,12 +1695,7 @@ void main_interface() {
                             FileSystem::create_file(dialog_name_buffer, FileSystem::EXT_TXT);
                         }
                         dialog_active = false;
-                        Graphics::clear_screen(0);
-                        draw_scp079_face();
-                        draw_panel_borders();
-                        draw_status_panel();
-                        redraw_file_manager();
-                        redraw_terminal();
+                        redraw_screen();
                     }
                 }
                 
@@ -2072,23 +1704,13 @@ void main_interface() {
                     if (dialog_name_pos > 0) {
                         FileSystem::create_directory(dialog_name_buffer);
                         dialog_active = false;
-                        Graphics::clear_screen(0);
-                        draw_scp079_face();
-                        draw_panel_borders();
-                        draw_status_panel();
-                        redraw_file_manager();
-                        redraw_terminal();
+                        redraw_screen();
                     }
                 }
                 
                 else if (mx >= DLG_X + 110 && mx <= DLG_X + 170 && my >= btn_y && my <= btn_y + 12) {
                     dialog_active = false;
-                    Graphics::clear_screen(0);
-                    draw_scp079_face();
-                    draw_panel_borders();
-                    draw_status_panel();
-                    redraw_file_manager();
-                    redraw_terminal();
+                    redraw_screen();
                 }
             }
         }
@@ -2100,7 +1722,7 @@ void main_interface() {
             
             if (dialog_needs_redraw || prev_dialog_pos != dialog_name_pos ||
                 prev_dialog_btn != dialog_button_index) {
-                draw_create_dialog();
+                draw_create_dialog(dialog_needs_redraw);
                 dialog_needs_redraw = false;
                 prev_dialog_pos = dialog_name_pos;
                 prev_dialog_btn = dialog_button_index;
@@ -2108,35 +1730,6 @@ void main_interface() {
         }
 
         
-        if (cursor_needs_redraw) {
-            
-            for (int dy = 0; dy < 8; dy++) {
-                for (int dx = 0; dx < 8; dx++) {
-                    int px = mouse.x + dx;
-                    int py = mouse.y + dy;
-                    if (px < 320 && py < 200) {
-                        cursor_buffer[dy][dx] = Graphics::get_pixel(px, py);
-                    }
-                }
-            }
-            saved_cursor_x = mouse.x;
-            saved_cursor_y = mouse.y;
-
-            
-            for (int dy = 0; dy < 8; dy++) {
-                for (int dx = 0; dx <= dy && dx < 8; dx++) {
-                    if (mouse.x + dx < 320 && mouse.y + dy < 200) {
-                        Graphics::put_pixel(mouse.x + dx, mouse.y + dy, 255);
-                    }
-                }
-            }
-
-            
-            prev_cursor_x = mouse.x;
-            prev_cursor_y = mouse.y;
-        }
-
-        
         if ((pit_ticks - cursor_last_toggle) >= 9) {
             cursor_last_toggle = pit_ticks;
             cursor_visible = !cursor_visible;
@@ -2155,12 +1748,7 @@ void main_interface() {
                     
                     dialog_active = false;
                     
-                    Graphics::clear_screen(0);
-                    draw_scp079_face();
-                    draw_panel_borders();
-                    draw_status_panel();
-                    redraw_file_manager();
-                    redraw_terminal();
+                    redraw_screen();
                     continue;
                 }
 
@@ -2188,12 +1776,7 @@ void main_interface() {
                     if (dialog_button_index == 2) {
                         
                         dialog_active = false;
-                        Graphics::clear_screen(0);
-                        draw_scp079_face();
-                        draw_panel_borders();
-                        draw_status_panel();
-                        redraw_file_manager();
-                        redraw_terminal();
+                        redraw_screen();
                     } else if (dialog_name_pos > 0) {
                         if (dialog_button_index == 0) {
                             
@@ -2208,13 +1791,8 @@ void main_interface() {
                             FileSystem::create_directory(dialog_name_buffer);
                         }
                         dialog_active = false;
-                        Graphics::clear_screen(0);
-                        draw_scp079_face();
-                        draw_panel_borders();
-                        draw_status_panel();
                         fm_selected_index = 0;
-                        redraw_file_manager();
-                        redraw_terminal();
+                        redraw_screen();
                     }
                     continue;
                 }
@@ -2298,23 +1876,16 @@ void main_interface() {
             
             if (fm_viewing_file && !file_edit_mode) {
                 if (scancode == KEY_UP) {
-                    if (fm_file_scroll_offset > 0) {
-                        fm_file_scroll_offset--;
-                        redraw_file_manager();
-                    }
+                    scroll_file_viewer(-1);
                     continue;
                 } else if (scancode == KEY_DOWN) {
-                    fm_file_scroll_offset++;
-                    redraw_file_manager();
+                    scroll_file_viewer(1);
                     continue;
                 } else if (scancode == KEY_PGUP) {
-                    fm_file_scroll_offset -= 6;
-                    if (fm_file_scroll_offset < 0) fm_file_scroll_offset = 0;
-                    redraw_file_manager();
+                    scroll_file_viewer(-6);
                     continue;
                 } else if (scancode == KEY_PGDN) {
-                    fm_file_scroll_offset += 6;
-                    redraw_file_manager();
+                    scroll_file_viewer(6);
                     continue;
                 } else if (scancode == KEY_LEFT || scancode == KEY_BACKSPACE) {
                     
@@ -2458,11 +2029,11 @@ void main_interface() {
                 cmd_buffer[cmd_pos] = '\0';
 
                 
-                char cmd_line[LINE_WIDTH + 1];
+                char cmd_line[LINE_CAPACITY + 1];
                 strcpy(cmd_line, "079>");
                 int len = strlen(cmd_line);
                 int i = 0;
-                while (i < LINE_WIDTH - len - 1 && cmd_buffer[i]) {
+                while (i < term_columns - len - 1 && cmd_buffer[i]) {
                     cmd_line[len + i] = cmd_buffer[i];
                     i++;
                 }
@@ -2476,6 +2047,7 @@ void main_interface() {
 
                 
                 cursor_x = 37;  
+                cursor_y = term_y + term_h - 10;
                 cmd_pos = 0;
 
             } else if (c == '\b') {
@@ -2486,7 +2058,7 @@ void main_interface() {
                     Graphics::draw_rect(cursor_x, cursor_y, 8, 8, 0);
                 }
             } else if (c == 0x18) {  
-                if (scroll_offset < buffer_lines - 10) {
+                if (scroll_offset < buffer_lines - term_visible_lines - 1) {
                     scroll_offset++;
                     redraw_terminal();
                 }
@@ -2526,7 +2098,7 @@ extern "C" void kernel_main() {
     Mouse::initialize();
 
     
-    Graphics::initialize();
+    Graphics::initialize(get_memory_end());
 
 
     boot_sequence();
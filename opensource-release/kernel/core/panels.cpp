@@ -0,0 +1,758 @@
+#include "panels.h"
+#include "graphics.h"
+#include "bochs_vbe.h"
+#include "smooth_font.h"
+#include "text_layout.h"
+#include "fs/fs.h"
+#include "string.h"
+
+
+// Panel geometry, recomputed by layout_panels() for the current canvas.
+// The 320x200 canvas gives the original 99/173 split.
+int screen_w;
+int screen_h;
+int face_scale;
+
+
+int split_x;
+int split_y;
+int term_right;
+
+
+int fm_x;
+int fm_w;
+int fm_h;
+
+
+int term_y;
+int term_w;
+int term_h;
+int term_text_w;
+int term_visible_lines;
+int term_columns;
+
+
+int status_x;
+int status_y;
+int status_w;
+int status_h;
+
+
+bool fm_viewing_file = false;
+char fm_current_file[64] = "";
+int fm_selected_index = 0;
+int fm_file_scroll_offset = 0;  
+int fm_list_scroll_offset = 0;  
+static uint32_t fm_view_hash = 0;
+
+
+int fm_view_lines;
+int fm_view_h;
+
+
+bool file_edit_mode = false;
+
+
+bool dialog_active = false;
+char dialog_name_buffer[64] = "";
+int dialog_name_pos = 0;
+int dialog_button_index = 0;
+
+
+static char line_buffer[MAX_LINES][LINE_CAPACITY + 1];
+static uint8_t line_colors[MAX_LINES];
+int buffer_lines = 0;  
+int scroll_offset = 0;  
+static int lines_dropped = 0;
+
+
+static int term_view_top = -1;
+static int term_view_end = 0;
+
+
+// The status panel shows what the kernel probed at boot; the host build has
+// no BIOS data area to read the RAM size from.
+static const char* status_cpu = "";
+static uint32_t status_ram_mb = 0;
+
+
+static Surface fm_surface;
+static Surface term_surface;
+static Surface status_surface;
+static uint8_t* panel_storage = nullptr;
+static bool panel_surfaces_ready = false;
+
+
+static void begin_panel_update(Surface* surface) {
+    if (panel_surfaces_ready) {
+        Graphics::set_target(surface);
+    }
+}
+
+
+static void end_panel_update(Surface* surface) {
+    if (panel_surfaces_ready) {
+        Graphics::set_target(nullptr);
+        Graphics::blit_surface(surface);
+    }
+}
+
+
+// Copies only the given screen-space band of the panel, for updates such
+// as a scroll that leave the rest of the panel untouched.
+static void end_panel_update(Surface* surface, int x, int y, int width, int height) {
+    if (panel_surfaces_ready) {
+        ClipRect band = {x - surface->origin_x, y - surface->origin_y, width, height};
+        Graphics::set_target(nullptr);
+        Graphics::blit(surface, &band, x, y, BLIT_OPAQUE);
+    }
+}
+
+
+static void render_panel(Surface* surface, void (*draw)()) {
+    begin_panel_update(surface);
+    draw();
+    end_panel_update(surface);
+}
+
+
+static void composite_panel(Surface* surface, void (*draw)()) {
+    if (panel_surfaces_ready) {
+        Graphics::blit_surface(surface);
+    } else {
+        draw();
+    }
+}
+
+
+void layout_panels() {
+    screen_w = Graphics::get_width();
+    screen_h = Graphics::get_height();
+
+    // The face panel grows in whole multiples of the 99-pixel original,
+    // capped at 2x so the scaled face still fits an ImageScaler slot; the
+    // rest of a larger canvas goes to the text panels.
+    face_scale = screen_w / SCREEN_WIDTH < screen_h / SCREEN_HEIGHT ? screen_w / SCREEN_WIDTH : screen_h / SCREEN_HEIGHT;
+    if (face_scale < 1) face_scale = 1;
+    if (face_scale > 2) face_scale = 2;
+    split_x = 99 * face_scale;
+    split_y = 99 * face_scale;
+    term_right = screen_w * 173 / SCREEN_WIDTH;
+
+    fm_x = split_x + 1;
+    fm_w = screen_w - fm_x;
+    fm_h = split_y;
+    fm_view_lines = (fm_h - fm_view_y - 6) / 10;
+    fm_view_h = fm_view_lines * 10 - 2;
+
+    term_y = split_y + 1;
+    term_w = term_right;
+    term_h = screen_h - term_y;
+    term_text_w = term_w - 10;
+    term_visible_lines = (term_h - 10) / TERM_LINE_HEIGHT;
+    term_columns = (term_w - 5) / FONT_WIDTH;
+    if (term_columns > LINE_CAPACITY) term_columns = LINE_CAPACITY;
+
+    status_x = term_right + 1;
+    status_y = split_y + 1;
+    status_w = screen_w - status_x;
+    status_h = screen_h - status_y;
+}
+
+
+static void place_panel(Surface* surface, uint8_t** storage, int x, int y, int width, int height) {
+    Graphics::wrap_surface(surface, *storage, width, height);
+    surface->origin_x = x;
+    surface->origin_y = y;
+    *storage += width * height;
+}
+
+
+// The panels never cover more than the canvas, so one canvas-sized block
+// holds them in every mode.
+void place_panels() {
+    if (!panel_storage) {
+        panel_storage = Graphics::pool_alloc(CANVAS_MAX_WIDTH * CANVAS_MAX_HEIGHT);
+    }
+    panel_surfaces_ready = panel_storage != nullptr;
+    if (panel_surfaces_ready) {
+        uint8_t* storage = panel_storage;
+        place_panel(&fm_surface, &storage, fm_x, fm_y, fm_w, fm_h);
+        place_panel(&term_surface, &storage, term_x, term_y, term_w, term_h);
+        place_panel(&status_surface, &storage, status_x, status_y, status_w, status_h);
+    }
+    term_view_top = -1;
+}
+
+
+void set_status_info(const char* cpu, uint32_t ram_mb) {
+    status_cpu = cpu;
+    status_ram_mb = ram_mb;
+}
+
+
+void draw_panel_borders() {
+    
+    Graphics::draw_vline(split_x, 0, screen_h, COL_WHITE);
+
+    
+    Graphics::draw_hline(0, split_y, screen_w, COL_WHITE);
+
+    
+    Graphics::draw_vline(term_right, term_y, screen_h - term_y, COL_WHITE);
+}
+
+
+void add_line(const char* text, uint8_t color) {
+    if (buffer_lines >= MAX_LINES) {
+        
+        for (int i = 0; i < MAX_LINES - 1; i++) {
+            strcpy(line_buffer[i], line_buffer[i + 1]);
+            line_colors[i] = line_colors[i + 1];
+        }
+        buffer_lines = MAX_LINES - 1;
+        lines_dropped++;
+    }
+
+    
+    int i = 0;
+    while (i < LINE_CAPACITY && text[i]) {
+        line_buffer[buffer_lines][i] = text[i];
+        i++;
+    }
+    line_buffer[buffer_lines][i] = '\0';
+    line_colors[buffer_lines] = color;
+    buffer_lines++;
+}
+
+
+static void add_text_run(const char* text, int length, uint8_t color) {
+    const TextLayoutEntry* layout = TextLayout::layout(text, length, term_text_w);
+    if (!layout) {
+        add_line(text, color);
+        return;
+    }
+
+    for (int i = 0; i < layout->line_count; i++) {
+        const TextLine& span = layout->lines[i];
+        if (span.length == 0 && i == layout->line_count - 1) {
+            break;
+        }
+
+        char line[LINE_CAPACITY + 1];
+        for (int start = 0; start < span.length || start == 0; start += LINE_CAPACITY) {
+            int n = span.length - start < LINE_CAPACITY ? span.length - start : LINE_CAPACITY;
+            for (int j = 0; j < n; j++) {
+                line[j] = text[span.start + start + j];
+            }
+            line[n] = '\0';
+            add_line(line, color);
+        }
+    }
+}
+
+
+void add_text(const char* text, uint8_t color) {
+    int length = strlen(text);
+    while (length > LAYOUT_MAX_CHARS) {
+        add_text_run(text, LAYOUT_MAX_CHARS, color);
+        text += LAYOUT_MAX_CHARS;
+        length -= LAYOUT_MAX_CHARS;
+    }
+    add_text_run(text, length, color);
+}
+
+
+void clear_buffer() {
+    buffer_lines = 0;
+    scroll_offset = 0;
+    term_view_top = -1;
+}
+
+
+static void get_terminal_window(int* start_line, int* end_line) {
+    int start = buffer_lines - term_visible_lines - scroll_offset;
+    if (start < 0) start = 0;
+    int end = start + term_visible_lines;
+    if (end > buffer_lines) end = buffer_lines;
+    *start_line = start;
+    *end_line = end;
+}
+
+
+static void draw_terminal_line(int index, int row) {
+    if (line_buffer[index][0] != '\0') {
+        TextLayout::draw_text(5, term_y + row * TERM_LINE_HEIGHT, line_buffer[index], line_colors[index]);
+    }
+}
+
+
+void draw_terminal() {
+    Graphics::draw_rect(term_x, term_y, term_w, term_h, COL_BLACK);
+
+    int start_line, end_line;
+    get_terminal_window(&start_line, &end_line);
+
+    Graphics::push_clip(term_x, term_y, term_w, term_h);
+    for (int i = start_line; i < end_line; i++) {
+        draw_terminal_line(i, i - start_line);
+    }
+
+    
+    Graphics::draw_text(5, term_y + term_h - 10, "079>", COL_WHITE);
+    Graphics::pop_clip();
+
+    term_view_top = lines_dropped + start_line;
+    term_view_end = lines_dropped + end_line;
+}
+
+
+void redraw_terminal() {
+    int start_line, end_line;
+    get_terminal_window(&start_line, &end_line);
+    int top = lines_dropped + start_line;
+    int delta = top - term_view_top;
+    if (term_view_top < 0 || delta >= term_visible_lines || delta <= -term_visible_lines) {
+        render_panel(&term_surface, draw_terminal);
+        return;
+    }
+
+    
+    const int text_h = term_visible_lines * TERM_LINE_HEIGHT;
+    begin_panel_update(&term_surface);
+    Graphics::push_clip(term_x, term_y, term_w, text_h);
+    Graphics::scroll_region(term_x, term_y, term_w, text_h, -delta * TERM_LINE_HEIGHT, COL_BLACK);
+    for (int i = start_line; i < end_line; i++) {
+        int line = lines_dropped + i;
+        if (line < term_view_top || line >= term_view_end) {
+            draw_terminal_line(i, i - start_line);
+        }
+    }
+    Graphics::pop_clip();
+    end_panel_update(&term_surface, term_x, term_y, term_w, text_h);
+
+    term_view_top = top;
+    term_view_end = lines_dropped + end_line;
+}
+
+static void draw_viewer_lines(const TextLayoutEntry* layout, const char* content, int first, int last) {
+    for (int i = first; layout && i < last && i < layout->line_count; i++) {
+        int draw_y = fm_view_y + (i - fm_file_scroll_offset) * 10;
+        TextLayout::draw_line(layout, content, i, fm_x + 3, draw_y, 150);
+    }
+}
+
+
+static void draw_viewer_scroll_info(int total_lines) {
+    if (total_lines <= fm_view_lines) {
+        return;
+    }
+
+    char scroll_info[20];
+    strcpy(scroll_info, "[");
+    char num[8];
+    itoa(fm_file_scroll_offset + 1, num, 10);
+    safe_strcat(scroll_info, num, sizeof(scroll_info));
+    safe_strcat(scroll_info, "/", sizeof(scroll_info));
+    itoa(total_lines - fm_view_lines + 1, num, 10);
+    safe_strcat(scroll_info, num, sizeof(scroll_info));
+    safe_strcat(scroll_info, "]", sizeof(scroll_info));
+    Graphics::draw_text(fm_x + fm_w - 50, fm_y + fm_h - 8, scroll_info, 80);
+}
+
+void draw_file_manager() {
+    fm_view_hash = 0;
+
+    
+    Graphics::draw_rect(fm_x, fm_y, fm_w, FM_TOOLBAR, COL_TOOLBAR);
+
+    
+    if (fm_viewing_file) {
+        
+        int btn_x = fm_x + 3;
+        int btn_y = fm_y + 1;
+        Graphics::draw_rect(btn_x, btn_y, 10, 8, 120);
+        Graphics::draw_outline(btn_x, btn_y, 10, 8, 200);
+        Graphics::draw_char(btn_x + 1, btn_y, '<', 0);
+
+        
+        Graphics::draw_text(fm_x + 15, btn_y, fm_current_file, 200);
+        if (file_edit_mode) {
+            Graphics::draw_text(fm_x + fm_w - 35, btn_y, "[EDIT]", 46);
+        } else {
+            Graphics::draw_text(fm_x + fm_w - 35, btn_y, "[VIEW]", 100);
+        }
+
+        
+        Graphics::draw_hline(fm_x, fm_y + FM_TOOLBAR, fm_w, 200);
+
+        
+        FileSystem::FileNode* node = FileSystem::find_node(fm_current_file);
+        if (node && node->type == FileSystem::TYPE_FILE) {
+            const TextLayoutEntry* layout = TextLayout::layout(node->content, node->content_size, fm_w - 6);
+            int total_lines = layout ? layout->line_count : 0;
+
+            
+            int max_scroll = total_lines - fm_view_lines;
+            if (max_scroll < 0) max_scroll = 0;
+            if (fm_file_scroll_offset > max_scroll) fm_file_scroll_offset = max_scroll;
+            if (fm_file_scroll_offset < 0) fm_file_scroll_offset = 0;
+
+            Graphics::push_clip(fm_x, fm_view_y, fm_w, fm_view_h);
+            draw_viewer_lines(layout, node->content, fm_file_scroll_offset, fm_file_scroll_offset + fm_view_lines);
+            Graphics::pop_clip();
+            draw_viewer_scroll_info(total_lines);
+            fm_view_hash = layout ? layout->hash : 0;
+        }
+        return;  
+    }
+
+    
+    int btn_x = fm_x + 3;
+    int btn_y = fm_y + 1;
+    Graphics::draw_rect(btn_x, btn_y, 10, 8, 120);  
+    
+    Graphics::draw_outline(btn_x, btn_y, 10, 8, 200);
+    Graphics::draw_char(btn_x + 1, btn_y, '+', 0);  
+
+    
+    btn_x = fm_x + 15;
+    Graphics::draw_rect(btn_x, btn_y, 10, 8, 120);  
+    
+    Graphics::draw_outline(btn_x, btn_y, 10, 8, 200);
+    Graphics::draw_char(btn_x + 1, btn_y, '<', 0);  
+
+    
+    char path[256];
+    FileSystem::get_current_path(path, 256);
+    Graphics::draw_text(fm_x + 28, btn_y, path, 200);
+
+    
+    Graphics::draw_hline(fm_x, fm_y + FM_TOOLBAR, fm_w, 200);
+
+    
+    FileSystem::FileNode* results[32];
+    int count = FileSystem::list_directory(results, 32);
+
+    
+    if (count == 0) {
+        Graphics::draw_text(fm_x + 5, fm_y + FM_TOOLBAR + 3, "(empty)", 100);
+    } else {
+        int file_y = fm_y + FM_TOOLBAR + 3;  
+        int shown = 0;
+        int dirs_count = 0;
+        int files_count = 0;
+
+        
+        for (int i = 0; i < count; i++) {
+            if (results[i]->type == FileSystem::TYPE_DIRECTORY) {
+                dirs_count++;
+            } else {
+                files_count++;
+            }
+        }
+
+        
+        for (int i = 0; i < count && file_y < fm_y + fm_h - 10; i++) {
+            int x = fm_x + 3;
+
+            
+            if (i == fm_selected_index) {
+                Graphics::blend_rect(fm_x, file_y - 1, fm_w, 10, COL_WHITE, BLEND_QUARTER);
+            }
+
+            
+            if (results[i]->type == FileSystem::TYPE_DIRECTORY) {
+                
+                Graphics::draw_char(x, file_y, '[', 120);
+                Graphics::draw_char(x + 8, file_y, '>', 120);
+                Graphics::draw_char(x + 16, file_y, ']', 120);
+                x += 24;
+
+                
+                const char* name = results[i]->name;
+                for (int j = 0; name[j] && x < fm_x + fm_w - 40; j++) {
+                    Graphics::draw_char(x, file_y, name[j], 180);
+                    x += 8;
+                }
+                Graphics::draw_char(x, file_y, '/', 180);
+
+                
+                Graphics::draw_text(fm_x + fm_w - 35, file_y, "<DIR>", 100);
+            } else {
+                
+                Graphics::draw_char(x, file_y, '[', 100);
+
+                
+                if (results[i]->extension == FileSystem::EXT_TXT) {
+                    Graphics::draw_char(x + 8, file_y, 'T', 100);
+                } else if (results[i]->extension == FileSystem::EXT_CPP) {
+                    Graphics::draw_char(x + 8, file_y, 'C', 100);
+                } else if (results[i]->extension == FileSystem::EXT_C) {
+                    Graphics::draw_char(x + 8, file_y, 'C', 100);
+                } else if (results[i]->extension == FileSystem::EXT_H) {
+                    Graphics::draw_char(x + 8, file_y, 'H', 100);
+                } else if (results[i]->extension == FileSystem::EXT_ASM) {
+                    Graphics::draw_char(x + 8, file_y, 'A', 100);
+                } else {
+                    Graphics::draw_char(x + 8, file_y, 'F', 100);
+                }
+
+                Graphics::draw_char(x + 16, file_y, ']', 100);
+                x += 24;
+
+                
+                const char* name = results[i]->name;
+                for (int j = 0; name[j] && x < fm_x + fm_w - 45; j++) {
+                    Graphics::draw_char(x, file_y, name[j], 150);
+                    x += 8;
+                }
+
+                
+                char size_str[8];
+                itoa(results[i]->content_size, size_str, 10);
+                int size_width;
+                Graphics::measure_text(size_str, &size_width, nullptr);
+                Graphics::draw_text(fm_x + fm_w - 35, file_y, size_str, 100);
+                Graphics::draw_char(fm_x + fm_w - 35 + size_width, file_y, 'b', 80);
+            }
+
+            file_y += 10;  
+            shown++;
+        }
+
+        
+        if (count > shown) {
+            char status[32];
+            strcpy(status, "(");
+            char num[8];
+            itoa(count - shown, num, 10);
+            safe_strcat(status, num, sizeof(status));
+            safe_strcat(status, " more...)", sizeof(status));
+            Graphics::draw_text(fm_x + 5, fm_y + fm_h - 8, status, 80);
+        }
+    }
+}
+
+
+static void draw_file_manager_panel() {
+    Graphics::draw_rect(fm_x, fm_y, fm_w, fm_h, COL_BLACK);
+    draw_file_manager();
+}
+
+void redraw_file_manager() {
+    render_panel(&fm_surface, draw_file_manager_panel);
+}
+
+
+void scroll_file_viewer(int delta) {
+    FileSystem::FileNode* node = fm_viewing_file ? FileSystem::find_node(fm_current_file) : nullptr;
+    const TextLayoutEntry* layout = nullptr;
+    if (node && node->type == FileSystem::TYPE_FILE) {
+        layout = TextLayout::layout(node->content, node->content_size, fm_w - 6);
+    }
+    if (!layout || layout->hash != fm_view_hash) {
+        fm_file_scroll_offset += delta;
+        if (fm_file_scroll_offset < 0) fm_file_scroll_offset = 0;
+        redraw_file_manager();
+        return;
+    }
+
+    int max_scroll = layout->line_count - fm_view_lines;
+    if (max_scroll < 0) max_scroll = 0;
+    int previous = fm_file_scroll_offset;
+    fm_file_scroll_offset += delta;
+    if (fm_file_scroll_offset > max_scroll) fm_file_scroll_offset = max_scroll;
+    if (fm_file_scroll_offset < 0) fm_file_scroll_offset = 0;
+
+    int moved = fm_file_scroll_offset - previous;
+    if (moved == 0) {
+        return;
+    }
+    if (moved >= fm_view_lines || moved <= -fm_view_lines) {
+        redraw_file_manager();
+        return;
+    }
+
+    
+    begin_panel_update(&fm_surface);
+    Graphics::push_clip(fm_x, fm_view_y, fm_w, fm_view_h);
+    Graphics::scroll_region(fm_x, fm_view_y, fm_w, fm_view_h, -moved * 10, COL_BLACK);
+    if (moved > 0) {
+        draw_viewer_lines(layout, node->content, previous + fm_view_lines, fm_file_scroll_offset + fm_view_lines);
+    } else {
+        draw_viewer_lines(layout, node->content, fm_file_scroll_offset, previous);
+    }
+    Graphics::pop_clip();
+
+    Graphics::draw_rect(fm_x + fm_w - 50, fm_y + fm_h - 8, 50, 8, COL_BLACK);
+    draw_viewer_scroll_info(layout->line_count);
+    end_panel_update(&fm_surface, fm_x, fm_view_y, fm_w, fm_view_h);
+    end_panel_update(&fm_surface, fm_x + fm_w - 50, fm_y + fm_h - 8, 50, 8);
+}
+
+
+void draw_create_dialog(bool opening) {
+    const int DLG_WIDTH = 180;
+    const int DLG_HEIGHT = 80;
+    const int DLG_X = (screen_w - DLG_WIDTH) / 2;
+    const int DLG_Y = (screen_h - DLG_HEIGHT) / 2;
+
+    
+    if (opening) {
+        Graphics::blend_rect(DLG_X + 4, DLG_Y + DLG_HEIGHT, DLG_WIDTH, 4, COL_BLACK, BLEND_HALF);
+        Graphics::blend_rect(DLG_X + DLG_WIDTH, DLG_Y + 4, 4, DLG_HEIGHT - 4, COL_BLACK, BLEND_HALF);
+    }
+
+    
+    Graphics::draw_rect(DLG_X, DLG_Y, DLG_WIDTH, DLG_HEIGHT, 50);
+
+    
+    Graphics::draw_outline(DLG_X, DLG_Y, DLG_WIDTH, DLG_HEIGHT, 200);
+
+    
+    Graphics::draw_text(DLG_X + 5, DLG_Y + 5, "Create New", 255);
+
+    
+    Graphics::draw_rect(DLG_X + 10, DLG_Y + 20, DLG_WIDTH - 20, 12, 80);
+    
+    Graphics::draw_outline(DLG_X + 10, DLG_Y + 20, DLG_WIDTH - 20, 12, 150);
+
+    
+    Graphics::draw_text(DLG_X + 12, DLG_Y + 22, dialog_name_buffer, 255);
+
+    
+    int cursor_x = DLG_X + 12 + (dialog_name_pos * 8);
+    if (cursor_x < DLG_X + DLG_WIDTH - 15) {
+        Graphics::draw_rect(cursor_x, DLG_Y + 22, 2, 8, 255);
+    }
+
+    
+    Graphics::draw_text(DLG_X + 10, DLG_Y + 38, "Name with extension", 150);
+    Graphics::draw_text(DLG_X + 10, DLG_Y + 48, ".txt .cpp .c .h .asm", 120);
+
+    
+    int btn_y = DLG_Y + DLG_HEIGHT - 20;
+
+    
+    uint8_t file_bg = (dialog_button_index == 0) ? 130 : 100;
+    uint8_t file_border = (dialog_button_index == 0) ? 255 : 180;
+    uint8_t folder_bg = (dialog_button_index == 1) ? 130 : 100;
+    uint8_t folder_border = (dialog_button_index == 1) ? 255 : 180;
+    uint8_t cancel_bg = (dialog_button_index == 2) ? 130 : 100;
+    uint8_t cancel_border = (dialog_button_index == 2) ? 255 : 180;
+
+    
+    Graphics::draw_rect(DLG_X + 10, btn_y, 40, 12, file_bg);
+    Graphics::draw_outline(DLG_X + 10, btn_y, 40, 12, file_border);
+    Graphics::draw_text(DLG_X + 14, btn_y + 2, "File", 255);
+
+    
+    Graphics::draw_rect(DLG_X + 55, btn_y, 50, 12, folder_bg);
+    Graphics::draw_outline(DLG_X + 55, btn_y, 50, 12, folder_border);
+    Graphics::draw_text(DLG_X + 58, btn_y + 2, "Folder", 255);
+
+    
+    Graphics::draw_rect(DLG_X + 110, btn_y, 60, 12, cancel_bg);
+    Graphics::draw_outline(DLG_X + 110, btn_y, 60, 12, cancel_border);
+    Graphics::draw_text(DLG_X + 115, btn_y + 2, "Cancel", 255);
+
+    
+    Graphics::draw_text(DLG_X + 5, DLG_Y + DLG_HEIGHT - 7, "Tab=Switch Enter=OK", 80);
+}
+
+
+// Names the current video mode as "13h 320x200x256", "X 320x240x256" or
+// "VBE 1024x768x32": resolution, then colors for the VGA modes and bits
+// per pixel for VBE, as vmode takes them.
+void format_video_mode(char* out, int size) {
+    VideoMode mode = Graphics::get_video_mode();
+    strcpy(out, mode == VIDEO_MODE_LFB ? "VBE " : mode == VIDEO_MODE_X ? "X " : "13h ");
+
+    char num[8];
+    itoa(Graphics::get_display_width(), num, 10);
+    safe_strcat(out, num, size);
+    safe_strcat(out, "x", size);
+    itoa(Graphics::get_display_height(), num, 10);
+    safe_strcat(out, num, size);
+    safe_strcat(out, "x", size);
+    if (mode == VIDEO_MODE_LFB) {
+        itoa(BochsVBE::get_bpp(), num, 10);
+        safe_strcat(out, num, size);
+    } else {
+        safe_strcat(out, "256", size);
+    }
+}
+
+
+void draw_status_panel() {
+    const int PX = status_x;
+    const int PY = status_y;
+    const int PW = status_w;
+    const int PH = status_h;
+
+    
+    Graphics::draw_rect(PX + 1, PY + 1, PW - 1, PH - 1, 15);
+
+    
+    Graphics::draw_rect(PX + 1, PY + 1, PW - 1, 10, 40);
+    Graphics::draw_text(PX + 5, PY + 2, "SYSTEM STATUS", 200);
+
+    int y = PY + 14;
+
+    
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5, y, "OS: QUICKS v1.0", 150, 15);
+    y += 10;
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5, y, "CPU: ", 150, 15);
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5 + 30, y, status_cpu, 150, 15);
+    y += 10;
+
+    char ram_line[20];
+    strcpy(ram_line, "RAM: ");
+    uint32_t total_mb = status_ram_mb;
+    char num[8];
+    if (total_mb > 0) {
+        itoa(total_mb, num, 10);
+        safe_strcat(ram_line, num, sizeof(ram_line));
+        safe_strcat(ram_line, " MB", sizeof(ram_line));
+    } else {
+        safe_strcat(ram_line, "640 KB", sizeof(ram_line));
+    }
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5, y, ram_line, 150, 15);
+    y += 10;
+
+    char video_line[32];
+    strcpy(video_line, "Video: ");
+    format_video_mode(video_line + 7, sizeof(video_line) - 7);
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5, y, video_line, 150, 15);
+    y += 10;
+
+    
+    Graphics::draw_hline(PX + 3, y, PW - 6, 80);
+    y += 4;
+
+    
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5, y, "[OK] Keyboard", 46, 15);
+    y += 10;
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5, y, "[OK] Mouse", 46, 15);
+    y += 10;
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5, y, "[OK] FS Ready", 46, 15);
+    y += 14;
+
+    
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5, y, "F1=Help F2=New", 80, 15);
+    y += 10;
+    SmoothFont::draw_text(FONT_FACE_6X8, PX + 5, y, "F3=Edit", 80, 15);
+}
+
+
+void redraw_status_panel() {
+    render_panel(&status_surface, draw_status_panel);
+}
+
+
+void composite_panels() {
+    composite_panel(&status_surface, draw_status_panel);
+    composite_panel(&fm_surface, draw_file_manager_panel);
+    composite_panel(&term_surface, draw_terminal);
+}
@@ -0,0 +1,221 @@
+#include "host_platform.h"
+#include "graphics.h"
+#include "bmp.h"
+#include "string.h"
+
+
+// Feeds hand-built BMP files, valid and hostile, to BMP::load_from_memory.
+// A hostile header must be rejected before the decoder sizes anything from
+// it; a valid one must still decode to the expected pixels.
+//
+// Usage: bmp_test
+
+#define VGA_WINDOW_BASE 0xA0000
+#define VGA_WINDOW_SIZE 0x20000
+#define TEST_FILE_MAX 4096
+#define GUARD_SIZE 4096
+
+struct Case {
+    const char* name;
+    bool (*run)();
+};
+
+static uint8_t* const framebuffer = (uint8_t*)VGA_WINDOW_BASE;
+static uint8_t file[TEST_FILE_MAX];
+static uint8_t* guard;
+
+
+static void put16(uint8_t* p, uint32_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+}
+
+static void put32(uint8_t* p, uint32_t value) {
+    put16(p, value & 0xFFFF);
+    put16(p + 2, value >> 16);
+}
+
+
+// Writes the file and info headers plus a gray palette for indexed formats;
+// returns the offset of the pixel data.
+static uint32_t write_headers(int32_t width, int32_t height, int bpp, int compression) {
+    int colors = bpp <= 8 ? 1 << bpp : 0;
+    uint32_t offset = 54 + colors * 4;
+    memset(file, 0, sizeof(file));
+    file[0] = 'B';
+    file[1] = 'M';
+    put32(file + 2, sizeof(file));
+    put32(file + 10, offset);
+    put32(file + 14, 40);
+    put32(file + 18, (uint32_t)width);
+    put32(file + 22, (uint32_t)height);
+    put16(file + 26, 1);
+    put16(file + 28, bpp);
+    put32(file + 30, compression);
+    put32(file + 46, colors);
+    for (int i = 0; i < colors; i++) {
+        uint8_t level = (uint8_t)(i * 255 / (colors - 1));
+        file[54 + i * 4] = level;
+        file[54 + i * 4 + 1] = level;
+        file[54 + i * 4 + 2] = level;
+    }
+    return offset;
+}
+
+
+static bool rejects_huge_24bpp() {
+    // stride * height wraps to zero in 32 bits, so only the header bounds
+    // stand between this file and a 12 GB decode.
+    write_headers(65536, 65536, 24, BMP_RGB);
+    return !BMP::load_from_memory(file, sizeof(file));
+}
+
+
+static bool rejects_wide_8bpp() {
+    write_headers(SCREEN_WIDTH + 1, 1, 8, BMP_RGB);
+    return !BMP::load_from_memory(file, sizeof(file));
+}
+
+
+static bool rejects_tall_top_down() {
+    write_headers(1, -(SCREEN_HEIGHT + 1), 8, BMP_RGB);
+    return !BMP::load_from_memory(file, sizeof(file));
+}
+
+
+static bool rejects_min_height() {
+    write_headers(1, (int32_t)0x80000000, 24, BMP_RGB);
+    return !BMP::load_from_memory(file, sizeof(file));
+}
+
+
+static bool decodes_small_8bpp() {
+    uint32_t offset = write_headers(4, 2, 8, BMP_RGB);
+    static const uint8_t rows[8] = {5, 6, 7, 8, 1, 2, 3, 4};
+    memcpy(file + offset, rows, sizeof(rows));
+    if (!BMP::load_from_memory(file, sizeof(file))) {
+        return false;
+    }
+
+    Graphics::clear_screen(0);
+    BMP::draw(0, 0);
+    Graphics::present();
+    BMP::free();
+    for (int i = 0; i < 4; i++) {
+        if (framebuffer[i] != i + 1 || framebuffer[SCREEN_WIDTH + i] != i + 5) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// The decode buffer is the first pool block allocated after the guard, so an
+// RLE stream that walks below the bottom row lands in the guard.
+static bool guard_intact() {
+    for (int i = 0; i < GUARD_SIZE; i++) {
+        if (guard[i] != 0xA5) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+static bool load_rle(const uint8_t* stream, uint32_t length) {
+    uint32_t offset = write_headers(4, 2, 8, BMP_RLE8);
+    memcpy(file + offset, stream, length);
+    bool loaded = BMP::load_from_memory(file, offset + length);
+    if (loaded) {
+        Graphics::clear_screen(0);
+        BMP::draw(0, 0);
+        Graphics::present();
+        BMP::free();
+    }
+    return loaded;
+}
+
+
+static bool survives_rle_delta_past_bottom() {
+    static const uint8_t stream[] = {0, 2, 0, 5, 4, 9, 0, 1};
+    load_rle(stream, sizeof(stream));
+    return guard_intact();
+}
+
+
+static bool survives_rle_rows_past_bottom() {
+    static const uint8_t stream[] = {0, 0, 0, 0, 0, 0, 0, 0, 4, 9, 0, 3, 1, 2, 3, 0, 0, 1};
+    load_rle(stream, sizeof(stream));
+    return guard_intact();
+}
+
+
+static bool clips_rle_run_to_row() {
+    static const uint8_t stream[] = {255, 7, 0, 1};
+    if (!load_rle(stream, sizeof(stream)) || !guard_intact()) {
+        return false;
+    }
+    for (int i = 0; i < 4; i++) {
+        if (framebuffer[SCREEN_WIDTH + i] != 7 || framebuffer[i] != 0) {
+            return false;
+        }
+    }
+    return framebuffer[SCREEN_WIDTH + 4] == 0;
+}
+
+
+static bool stops_rle_literal_at_end() {
+    static const uint8_t stream[] = {0, 200, 1, 2};
+    load_rle(stream, sizeof(stream));
+    return guard_intact();
+}
+
+
+static bool rejects_top_down_rle() {
+    uint32_t offset = write_headers(4, -2, 8, BMP_RLE8);
+    file[offset + 1] = 1;
+    return !BMP::load_from_memory(file, offset + 2);
+}
+
+
+static const Case cases[] = {
+    {"huge 24bpp header", rejects_huge_24bpp},
+    {"wide 8bpp header", rejects_wide_8bpp},
+    {"tall top-down header", rejects_tall_top_down},
+    {"INT_MIN height", rejects_min_height},
+    {"small 8bpp image", decodes_small_8bpp},
+    {"RLE delta past bottom", survives_rle_delta_past_bottom},
+    {"RLE rows past bottom", survives_rle_rows_past_bottom},
+    {"RLE run wider than row", clips_rle_run_to_row},
+    {"RLE literal past end", stops_rle_literal_at_end},
+    {"top-down RLE header", rejects_top_down_rle},
+};
+
+
+int main() {
+    if (!host_map_fixed(VGA_WINDOW_BASE, VGA_WINDOW_SIZE) ||
+        !host_map_fixed(GRAPHICS_POOL_BASE, GRAPHICS_POOL_SIZE)) {
+        host_print("bmp_test: cannot map the VGA window and graphics pool\n");
+        return 2;
+    }
+
+    Graphics::initialize(GRAPHICS_POOL_BASE + GRAPHICS_POOL_SIZE);
+    Graphics::set_mode_graphics();
+    guard = Graphics::pool_alloc(GUARD_SIZE);
+    memset(guard, 0xA5, GUARD_SIZE);
+
+    int failures = 0;
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bool ok = cases[i].run();
+        host_print("%-24s %s\n", cases[i].name, ok ? "ok" : "FAILED");
+        if (!ok) {
+            failures++;
+        }
+    }
+
+    if (failures) {
+        host_print("\n%d case(s) failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include "host_platform.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <time.h>
+
+bool host_map_fixed(unsigned long address, unsigned long size) {
+    void* mapped = mmap((void*)address, size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    return mapped == (void*)address;
+}
+
+unsigned long long host_now_ns() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+void host_print(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+}
+
+bool host_write_file(const char* path, const unsigned char* data, unsigned int size) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    bool ok = fwrite(data, 1, size, file) == size;
+    return fclose(file) == 0 && ok;
+}
+
+int host_read_file(const char* path, unsigned char* data, unsigned int max_size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return -1;
+    }
+    int size = (int)fread(data, 1, max_size, file);
+    fclose(file);
+    return size;
+}
@@ -0,0 +1,14 @@
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+
+// The kernel headers redefine size_t and string.h, so the render test
+// reaches libc only through this interface, using builtin types.
+
+bool host_map_fixed(unsigned long address, unsigned long size);
+unsigned long long host_now_ns();
+void host_print(const char* format, ...);
+bool host_write_file(const char* path, const unsigned char* data, unsigned int size);
+int host_read_file(const char* path, unsigned char* data, unsigned int max_size);
+
+#endif
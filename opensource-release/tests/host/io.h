@@ -0,0 +1,51 @@
+#ifndef IO_H
+#define IO_H
+
+#include "types.h"
+
+
+// Host build of include/io.h: port writes are dropped and port reads
+// return idle values, so the drivers run against RAM only.
+
+static inline void outb(uint16_t, uint8_t) {
+}
+
+static inline uint8_t inb(uint16_t port) {
+    
+    static uint8_t retrace = 0;
+    if (port == 0x3DA) {
+        retrace ^= 0x08;
+        return retrace;
+    }
+    return 0;
+}
+
+static inline void outw(uint16_t, uint16_t) {
+}
+
+static inline uint16_t inw(uint16_t) {
+    return 0;
+}
+
+static inline void outl(uint16_t, uint32_t) {
+}
+
+static inline uint32_t inl(uint16_t) {
+    return 0;
+}
+
+static inline void outsb(uint16_t, const void*, uint32_t) {
+}
+
+
+static inline void io_wait() {
+}
+
+
+static inline uint64_t read_tsc() {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+#endif
@@ -0,0 +1,440 @@
+#include "host_platform.h"
+#include "graphics.h"
+#include "span_kernels.h"
+#include "smooth_font.h"
+#include "text_layout.h"
+#include "image_scaler.h"
+#include "face_data.h"
+#include "panels.h"
+#include "fs/fs.h"
+#include "string.h"
+
+
+// Renders the kernel's own desktop panels into the mode 13h framebuffer
+// (plain RAM mapped at 0xA0000), compares them with golden 8-bit RLE BMPs,
+// then reports the cost of each drawing primitive for every span kernel
+// table.
+//
+// Usage: render_test <golden dir> <output dir> [--update]
+
+#define VGA_WINDOW_BASE 0xA0000
+#define VGA_WINDOW_SIZE 0x20000
+#define BMP_FILE_MAX (54 + 256 * 4 + SCREEN_WIDTH * SCREEN_HEIGHT * 2 + SCREEN_HEIGHT * 2 + 2)
+#define TIMING_ITERATIONS 2000
+
+struct Scene {
+    const char* name;
+    void (*render)();
+};
+
+struct Primitive {
+    const char* name;
+    void (*run)();
+};
+
+static uint8_t* const framebuffer = (uint8_t*)VGA_WINDOW_BASE;
+static uint8_t bmp_file[BMP_FILE_MAX];
+static uint8_t golden_file[BMP_FILE_MAX];
+static uint8_t golden_pixels[SCREEN_WIDTH * SCREEN_HEIGHT];
+static uint8_t face_pixels[FACE_WIDTH * FACE_HEIGHT];
+static Surface face;
+
+
+static void draw_file_manager_scene() {
+    fm_viewing_file = false;
+    fm_selected_index = 2;
+    fm_list_scroll_offset = 0;
+    draw_panel_borders();
+    redraw_file_manager();
+}
+
+
+static void draw_file_viewer_scene() {
+    fm_viewing_file = true;
+    strcpy(fm_current_file, "HELP.TXT");
+    fm_file_scroll_offset = 0;
+    draw_panel_borders();
+    redraw_file_manager();
+    scroll_file_viewer(3);
+    fm_viewing_file = false;
+}
+
+
+static void draw_terminal_scene() {
+    clear_buffer();
+    add_line("QUICKS v1.0", COL_BRIGHT);
+    add_text("SCP-079 OS", COL_TEXT);
+    char line[32];
+    for (int i = 0; i < 12; i++) {
+        strcpy(line, "> task ");
+        char num[12];
+        itoa(i * 37, num, 10);
+        strcat(line, num);
+        add_text(line, COL_TEXT);
+    }
+    add_text("A line long enough to wrap across the terminal panel", COL_LABEL);
+    add_text("> status: RUNNING", COL_GREEN);
+    draw_panel_borders();
+    redraw_terminal();
+}
+
+
+static void draw_create_dialog_scene() {
+    draw_panel_borders();
+    composite_panels();
+    strcpy(dialog_name_buffer, "NOTES.TXT");
+    dialog_name_pos = strlen(dialog_name_buffer);
+    dialog_button_index = 1;
+    draw_create_dialog(true);
+}
+
+
+static void draw_status_panel_scene() {
+    draw_panel_borders();
+    redraw_status_panel();
+}
+
+
+static void draw_scaled_face() {
+    ImageScaler::draw(&face, 0, 0, 160, 114, SCALE_BILINEAR);
+    ImageScaler::draw(&face, 170, 0, 70, 50, SCALE_NEAREST);
+    Graphics::blit(&face, nullptr, 170, 60, 0);
+}
+
+
+static const Scene scenes[] = {
+    {"file_manager", draw_file_manager_scene},
+    {"file_viewer", draw_file_viewer_scene},
+    {"terminal", draw_terminal_scene},
+    {"create_dialog", draw_create_dialog_scene},
+    {"status_panel", draw_status_panel_scene},
+    {"scaled_face", draw_scaled_face},
+};
+
+
+static void put16(uint8_t* p, uint32_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+}
+
+static void put32(uint8_t* p, uint32_t value) {
+    put16(p, value & 0xFFFF);
+    put16(p + 2, value >> 16);
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+
+static uint32_t encode_bmp(const uint8_t* pixels, uint8_t* out) {
+    uint32_t offset = 54 + 256 * 4;
+    memset(out, 0, offset);
+    out[0] = 'B';
+    out[1] = 'M';
+    put32(out + 10, offset);
+    put32(out + 14, 40);
+    put32(out + 18, SCREEN_WIDTH);
+    put32(out + 22, SCREEN_HEIGHT);
+    put16(out + 26, 1);
+    put16(out + 28, 8);
+    put32(out + 30, 1);
+    put32(out + 46, 256);
+
+    const uint8_t* palette = Graphics::get_palette();
+    for (int i = 0; i < 256; i++) {
+        out[54 + i * 4] = palette[i * 3 + 2];
+        out[54 + i * 4 + 1] = palette[i * 3 + 1];
+        out[54 + i * 4 + 2] = palette[i * 3];
+    }
+
+
+    uint8_t* p = out + offset;
+    for (int y = SCREEN_HEIGHT - 1; y >= 0; y--) {
+        const uint8_t* row = pixels + y * SCREEN_WIDTH;
+        int x = 0;
+        while (x < SCREEN_WIDTH) {
+            int run = 1;
+            while (x + run < SCREEN_WIDTH && run < 255 && row[x + run] == row[x]) {
+                run++;
+            }
+            if (run >= 3) {
+                *p++ = run;
+                *p++ = row[x];
+                x += run;
+                continue;
+            }
+
+
+            int literal = 0;
+            while (x + literal < SCREEN_WIDTH && literal < 255) {
+                int ahead = x + literal;
+                if (ahead + 2 < SCREEN_WIDTH && row[ahead] == row[ahead + 1] && row[ahead] == row[ahead + 2]) {
+                    break;
+                }
+                literal++;
+            }
+            if (literal < 3) {
+                for (int i = 0; i < literal; i++) {
+                    *p++ = 1;
+                    *p++ = row[x + i];
+                }
+            } else {
+                *p++ = 0;
+                *p++ = literal;
+                memcpy(p, row + x, literal);
+                p += literal;
+                if (literal & 1) {
+                    *p++ = 0;
+                }
+            }
+            x += literal;
+        }
+        *p++ = 0;
+        *p++ = 0;
+    }
+    *p++ = 0;
+    *p++ = 1;
+
+    uint32_t size = p - out;
+    put32(out + 2, size);
+    put32(out + 34, size - offset);
+    return size;
+}
+
+
+static bool decode_bmp(const uint8_t* data, uint32_t size, uint8_t* pixels) {
+    if (size < 54 || data[0] != 'B' || data[1] != 'M' || get32(data + 18) != SCREEN_WIDTH ||
+        get32(data + 22) != SCREEN_HEIGHT || data[28] != 8 || get32(data + 30) != 1) {
+        return false;
+    }
+
+    memset(pixels, 0, SCREEN_WIDTH * SCREEN_HEIGHT);
+    const uint8_t* p = data + get32(data + 10);
+    const uint8_t* end = data + size;
+    int x = 0;
+    int y = SCREEN_HEIGHT - 1;
+    while (p + 2 <= end) {
+        int count = *p++;
+        int value = *p++;
+        if (y < 0 && !(count == 0 && value == 1)) {
+            return false;
+        }
+        if (count) {
+            for (int i = 0; i < count && x < SCREEN_WIDTH; i++) {
+                pixels[y * SCREEN_WIDTH + x++] = value;
+            }
+        } else if (value == 0) {
+            x = 0;
+            y--;
+        } else if (value == 1) {
+            return true;
+        } else if (value == 2) {
+            if (p + 2 > end) {
+                return false;
+            }
+            x += *p++;
+            y -= *p++;
+        } else {
+            if (p + value > end) {
+                return false;
+            }
+            for (int i = 0; i < value && x < SCREEN_WIDTH; i++) {
+                pixels[y * SCREEN_WIDTH + x++] = p[i];
+            }
+            p += (value + 1) & ~1;
+        }
+    }
+    return false;
+}
+
+
+static void make_path(char* path, const char* dir, const char* name, const char* suffix) {
+    strcpy(path, dir);
+    strcat(path, "/");
+    strcat(path, name);
+    strcat(path, suffix);
+}
+
+
+static bool check_scene(const Scene* scene, const char* golden_dir, const char* output_dir, bool update) {
+    Graphics::clear_screen(0);
+    scene->render();
+    Graphics::present();
+
+    char path[256];
+    uint32_t size = encode_bmp(framebuffer, bmp_file);
+    if (update) {
+        make_path(path, golden_dir, scene->name, ".bmp");
+        bool ok = host_write_file(path, bmp_file, size);
+        host_print("%-16s %s\n", scene->name, ok ? "updated" : "WRITE FAILED");
+        return ok;
+    }
+
+    make_path(path, golden_dir, scene->name, ".bmp");
+    int golden_size = host_read_file(path, golden_file, BMP_FILE_MAX);
+    if (golden_size < 0 || !decode_bmp(golden_file, golden_size, golden_pixels)) {
+        host_print("%-16s MISSING %s\n", scene->name, path);
+        return false;
+    }
+
+
+    int mismatches = 0;
+    int x0 = SCREEN_WIDTH, y0 = SCREEN_HEIGHT, x1 = -1, y1 = -1;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            if (framebuffer[y * SCREEN_WIDTH + x] != golden_pixels[y * SCREEN_WIDTH + x]) {
+                mismatches++;
+                if (x < x0) x0 = x;
+                if (y < y0) y0 = y;
+                if (x > x1) x1 = x;
+                if (y > y1) y1 = y;
+            }
+        }
+    }
+
+    if (mismatches == 0) {
+        host_print("%-16s ok\n", scene->name);
+        return true;
+    }
+
+    make_path(path, output_dir, scene->name, ".actual.bmp");
+    host_write_file(path, bmp_file, size);
+    host_print("%-16s FAIL %d pixels differ in (%d,%d)-(%d,%d), wrote %s\n",
+               scene->name, mismatches, x0, y0, x1, y1, path);
+    return false;
+}
+
+
+static void time_clear() {
+    Graphics::clear_screen(0);
+}
+
+static void time_rect() {
+    Graphics::draw_rect(10, 10, 64, 64, 200);
+}
+
+static void time_text() {
+    Graphics::draw_text(4, 4, "The quick brown fox", 255);
+}
+
+static void time_layout_text() {
+    TextLayout::draw_text(4, 4, "The quick brown fox", 255);
+}
+
+static void time_smooth_text() {
+    SmoothFont::draw_text(FONT_FACE_8X12, 4, 4, "The quick brown fox", 255, 0);
+}
+
+static void time_blit() {
+    Graphics::blit(&face, nullptr, 10, 10, BLIT_OPAQUE);
+}
+
+static void time_blit_keyed() {
+    Graphics::blit(&face, nullptr, 10, 10, 0);
+}
+
+static void time_blend() {
+    Graphics::blend_rect(10, 10, 100, 50, 0, BLEND_HALF);
+}
+
+static void time_scroll() {
+    Graphics::scroll_region(0, 0, SCREEN_WIDTH, 160, -10, 0);
+}
+
+static void time_scale_cached() {
+    ImageScaler::draw(&face, 0, 0, 160, 114, SCALE_BILINEAR);
+}
+
+static void time_scale_render() {
+    ImageScaler::invalidate(face.pixels);
+    ImageScaler::draw(&face, 0, 0, 160, 114, SCALE_BILINEAR);
+}
+
+static void time_present() {
+    Graphics::mark_dirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    Graphics::present();
+}
+
+static const Primitive primitives[] = {
+    {"clear_screen", time_clear},
+    {"draw_rect 64x64", time_rect},
+    {"draw_text 19ch", time_text},
+    {"layout text 19ch", time_layout_text},
+    {"smooth text 19ch", time_smooth_text},
+    {"blit 140x100", time_blit},
+    {"blit keyed", time_blit_keyed},
+    {"blend_rect 100x50", time_blend},
+    {"scroll 320x160", time_scroll},
+    {"scale cached", time_scale_cached},
+    {"scale render", time_scale_render},
+    {"present full", time_present},
+};
+
+
+static void report_timings() {
+    const int count = sizeof(primitives) / sizeof(primitives[0]);
+    unsigned long long ns[2][count];
+
+    for (int sse = 0; sse < 2; sse++) {
+        SpanKernels::select(sse != 0);
+        for (int i = 0; i < count; i++) {
+            primitives[i].run();
+            unsigned long long start = host_now_ns();
+            for (int n = 0; n < TIMING_ITERATIONS; n++) {
+                primitives[i].run();
+            }
+            ns[sse][i] = (host_now_ns() - start) / TIMING_ITERATIONS;
+        }
+    }
+
+    SpanKernels::select(false);
+    host_print("\n%-20s %12s", "primitive", SpanKernels::get_name());
+    SpanKernels::select(true);
+    host_print(" %12s\n", SpanKernels::get_name());
+    for (int i = 0; i < count; i++) {
+        host_print("%-20s %9llu ns %9llu ns\n", primitives[i].name, ns[0][i], ns[1][i]);
+    }
+}
+
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        host_print("usage: render_test <golden dir> <output dir> [--update]\n");
+        return 2;
+    }
+    bool update = argc > 3 && strcmp(argv[3], "--update") == 0;
+
+    if (!host_map_fixed(VGA_WINDOW_BASE, VGA_WINDOW_SIZE) ||
+        !host_map_fixed(GRAPHICS_POOL_BASE, GRAPHICS_POOL_SIZE)) {
+        host_print("render_test: cannot map the VGA window and graphics pool\n");
+        return 2;
+    }
+
+    Graphics::initialize(GRAPHICS_POOL_BASE + GRAPHICS_POOL_SIZE);
+    Graphics::set_mode_graphics();
+    SpanKernels::select(false);
+
+    generate_face_data(face_pixels);
+    Graphics::wrap_surface(&face, face_pixels, FACE_WIDTH, FACE_HEIGHT);
+
+    FileSystem::initialize();
+    set_status_info("Host CPU", 64);
+    layout_panels();
+    place_panels();
+
+    int failures = 0;
+    for (uint32_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+        if (!check_scene(&scenes[i], argv[1], argv[2], update)) {
+            failures++;
+        }
+    }
+
+    report_timings();
+
+    if (failures) {
+        host_print("\n%d scene(s) failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,315 @@
+// Host-side asset packer: turns 8-bit PGM images into compressed blobs
+// (median edge prediction + adaptive Rice codes) for AssetCache.
+// Blobs are emitted in argument order, which must match AssetId; the same
+// goes for animations and AnimationId.
+//
+// Usage: asset_pack image.pgm ... [--animation keyframe strip.pgm frames ...]
+//
+// An animation strip stacks its frames vertically. Frame 0 must match the
+// image with index `keyframe`; every other frame, plus the wrap back to
+// frame 0, is stored as a row delta against the frame before it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define RICE_ESCAPE 24
+
+struct Image {
+    int width;
+    int height;
+    uint8_t* pixels;
+};
+
+struct BitWriter {
+    uint8_t* data;
+    uint32_t size;
+    uint32_t bits;
+};
+
+static int read_number(FILE* file) {
+    int c = fgetc(file);
+    while (c != EOF) {
+        if (c == '#') {
+            while (c != EOF && c != '\n') {
+                c = fgetc(file);
+            }
+        } else if (c >= '0' && c <= '9') {
+            break;
+        }
+        c = fgetc(file);
+    }
+
+    int value = -1;
+    while (c >= '0' && c <= '9') {
+        value = (value < 0 ? 0 : value * 10) + (c - '0');
+        c = fgetc(file);
+    }
+    return value;
+}
+
+static bool load_pgm(const char* path, Image* image) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "asset_pack: cannot open %s\n", path);
+        return false;
+    }
+
+    char magic[2];
+    if (fread(magic, 1, 2, file) != 2 || magic[0] != 'P' || (magic[1] != '2' && magic[1] != '5')) {
+        fprintf(stderr, "asset_pack: %s is not a PGM image\n", path);
+        fclose(file);
+        return false;
+    }
+
+    image->width = read_number(file);
+    image->height = read_number(file);
+    int max_value = read_number(file);
+    if (image->width <= 0 || image->height <= 0 || image->width > 65535 || image->height > 65535 || max_value != 255) {
+        fprintf(stderr, "asset_pack: %s must be an 8-bit image\n", path);
+        fclose(file);
+        return false;
+    }
+
+    int count = image->width * image->height;
+    image->pixels = (uint8_t*)malloc(count);
+    bool ok = true;
+    if (magic[1] == '5') {
+        ok = fread(image->pixels, 1, count, file) == (size_t)count;
+    } else {
+        for (int i = 0; i < count && ok; i++) {
+            int value = read_number(file);
+            ok = value >= 0 && value <= 255;
+            image->pixels[i] = (uint8_t)value;
+        }
+    }
+    fclose(file);
+
+    if (!ok) {
+        fprintf(stderr, "asset_pack: %s is truncated\n", path);
+    }
+    return ok;
+}
+
+static void put_bit(BitWriter* out, int bit) {
+    if ((out->bits & 7) == 0) {
+        out->data[out->size++] = 0;
+    }
+    if (bit) {
+        out->data[out->size - 1] |= 0x80 >> (out->bits & 7);
+    }
+    out->bits++;
+}
+
+static void put_bits(BitWriter* out, uint32_t value, int count) {
+    for (int i = count - 1; i >= 0; i--) {
+        put_bit(out, (value >> i) & 1);
+    }
+}
+
+// Must stay in step with AssetCache::decode.
+static int predict(const uint8_t* pixels, int width, int x, int y) {
+    int a = x ? pixels[y * width + x - 1] : (y ? pixels[(y - 1) * width] : 0);
+    int b = y ? pixels[(y - 1) * width + x] : a;
+    int c = (x && y) ? pixels[(y - 1) * width + x - 1] : b;
+    int lo = a < b ? a : b;
+    int hi = a < b ? b : a;
+    if (c >= hi) return lo;
+    if (c <= lo) return hi;
+    return a + b - c;
+}
+
+static uint32_t pack(const Image* image, uint8_t* data) {
+    BitWriter out = {data, 0, 0};
+    int total = 4;
+    int count = 1;
+
+    for (int y = 0; y < image->height; y++) {
+        for (int x = 0; x < image->width; x++) {
+            int error = (int8_t)(image->pixels[y * image->width + x] - predict(image->pixels, image->width, x, y));
+            uint32_t code = error >= 0 ? error * 2 : -error * 2 - 1;
+
+            int k = 0;
+            while ((count << k) < total) {
+                k++;
+            }
+
+            uint32_t quotient = code >> k;
+            if (quotient < RICE_ESCAPE) {
+                for (uint32_t i = 0; i < quotient; i++) {
+                    put_bit(&out, 1);
+                }
+                put_bit(&out, 0);
+                put_bits(&out, code, k);
+            } else {
+                for (int i = 0; i < RICE_ESCAPE; i++) {
+                    put_bit(&out, 1);
+                }
+                put_bits(&out, code, 8);
+            }
+
+            total += error < 0 ? -error : error;
+            if (++count == 64) {
+                total >>= 1;
+                count >>= 1;
+            }
+        }
+    }
+    return out.size;
+}
+
+static uint32_t pack_delta(const uint8_t* from, const uint8_t* to, int width, int height, uint8_t* data) {
+    uint32_t size = 1;
+    int rows = 0;
+
+    for (int y = 0; y < height; y++) {
+        const uint8_t* a = from + y * width;
+        const uint8_t* b = to + y * width;
+        if (memcmp(a, b, width) == 0) {
+            continue;
+        }
+
+        rows++;
+        data[size++] = (uint8_t)y;
+        int x = 0;
+        while (x < width) {
+            int start = x;
+            while (x < width && a[x] == b[x]) {
+                x++;
+            }
+            if (x == width) {
+                break;
+            }
+
+            // Runs swallow short unchanged gaps rather than paying two bytes
+            // for a new run header.
+            int skip = x - start;
+            int run = x;
+            while (x < width) {
+                if (a[x] != b[x]) {
+                    x++;
+                    continue;
+                }
+                int gap = x;
+                while (gap < width && a[gap] == b[gap] && gap - x < 3) {
+                    gap++;
+                }
+                if (gap < width && gap - x < 3) {
+                    x = gap;
+                } else {
+                    break;
+                }
+            }
+
+            data[size++] = (uint8_t)skip;
+            data[size++] = (uint8_t)(x - run);
+            for (int i = run; i < x; i++) {
+                data[size++] = a[i] ^ b[i];
+            }
+        }
+        data[size++] = 0;
+        data[size++] = 0;
+    }
+
+    data[0] = (uint8_t)rows;
+    return size;
+}
+
+static bool pack_animation(int index, const Image* images, int image_count, int keyframe, const char* path, int frames) {
+    Image strip;
+    if (!load_pgm(path, &strip)) {
+        return false;
+    }
+    if (keyframe < 0 || keyframe >= image_count || frames < 2 || frames > 255) {
+        fprintf(stderr, "asset_pack: bad animation parameters for %s\n", path);
+        return false;
+    }
+
+    const Image* key = &images[keyframe];
+    int frame_size = key->width * key->height;
+    if (strip.width != key->width || strip.height != key->height * frames || key->width > 255 || key->height > 255) {
+        fprintf(stderr, "asset_pack: %s does not hold %d frames of %dx%d\n", path, frames, key->width, key->height);
+        return false;
+    }
+    if (memcmp(strip.pixels, key->pixels, frame_size) != 0) {
+        fprintf(stderr, "asset_pack: %s frame 0 does not match its keyframe\n", path);
+        return false;
+    }
+
+    uint8_t* data = (uint8_t*)malloc(frames * (frame_size * 2 + 1));
+    uint32_t size = 0;
+    for (int f = 1; f <= frames; f++) {
+        const uint8_t* from = strip.pixels + (f - 1) * frame_size;
+        const uint8_t* to = strip.pixels + (f % frames) * frame_size;
+        size += pack_delta(from, to, key->width, key->height, data + size);
+    }
+
+    printf("// %s: %d frames, %u delta bytes\n", path, frames, size);
+    printf("static const uint8_t animation_data_%d[] = {", index);
+    for (uint32_t i = 0; i < size; i++) {
+        printf("%s0x%02X,", (i % 16) ? " " : "\n    ", data[i]);
+    }
+    printf("\n};\n\n");
+    free(data);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: asset_pack image.pgm ... [--animation keyframe strip.pgm frames ...]\n");
+        return 1;
+    }
+
+    printf("// Generated by tools/asset_pack. Do not edit.\n\n");
+    printf("#include \"asset_cache.h\"\n\n");
+
+    int image_end = 1;
+    while (image_end < argc && strcmp(argv[image_end], "--animation") != 0) {
+        image_end++;
+    }
+    if ((argc - image_end) % 4 != 0) {
+        fprintf(stderr, "asset_pack: --animation takes a keyframe index, a strip and a frame count\n");
+        return 1;
+    }
+
+    uint32_t* sizes = (uint32_t*)calloc(argc, sizeof(uint32_t));
+    Image* images = (Image*)calloc(argc, sizeof(Image));
+    for (int n = 1; n < image_end; n++) {
+        if (!load_pgm(argv[n], &images[n])) {
+            return 1;
+        }
+
+        uint32_t count = images[n].width * images[n].height;
+        uint8_t* data = (uint8_t*)malloc(count * 4 + 16);
+        sizes[n] = pack(&images[n], data);
+
+        printf("// %s: %u -> %u bytes\n", argv[n], count, sizes[n]);
+        printf("static const uint8_t asset_data_%d[] = {", n - 1);
+        for (uint32_t i = 0; i < sizes[n]; i++) {
+            printf("%s0x%02X,", (i % 16) ? " " : "\n    ", data[i]);
+        }
+        printf("\n};\n\n");
+        free(data);
+    }
+
+    int animation_count = 0;
+    for (int n = image_end; n < argc; n += 4) {
+        if (!pack_animation(animation_count++, images + 1, image_end - 1, atoi(argv[n + 1]), argv[n + 2], atoi(argv[n + 3]))) {
+            return 1;
+        }
+    }
+
+    printf("const PackedImage packed_assets[ASSET_COUNT] = {\n");
+    for (int n = 1; n < image_end; n++) {
+        printf("    {%d, %d, %u, asset_data_%d},\n", images[n].width, images[n].height, sizes[n], n - 1);
+    }
+    printf("};\n\n");
+
+    printf("const PackedAnimation packed_animations[ANIMATION_COUNT] = {\n");
+    for (int n = image_end, index = 0; n < argc; n += 4, index++) {
+        printf("    {(AssetId)%s, %s, animation_data_%d},\n", argv[n + 1], argv[n + 3], index);
+    }
+    printf("};\n");
+    return 0;
+}